@@ -0,0 +1,102 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+// Measures how long loading of dictionaries takes and how much memory it
+// leaves behind. Build it with -DHUNSPELL_BUILD_BENCHMARK=ON and run as
+//   hunspell_loadbench [-n cycles] /usr/share/hunspell/en_US [...]
+// Peak RSS is process-wide, so run it once per dictionary to compare peaks.
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "hunspell/hunspell.hxx"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// resident set size in KB, 0 if it's unknown on this platform
+long current_rss_kb() {
+#ifdef __linux__
+  FILE* f = fopen("/proc/self/statm", "r");
+  if (!f)
+    return 0;
+  long total = 0, resident = 0;
+  if (fscanf(f, "%ld %ld", &total, &resident) != 2)
+    resident = 0;
+  fclose(f);
+  return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+  return 0;
+#endif
+}
+
+long peak_rss_kb() {
+#ifdef __linux__
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+#else
+  return 0;
+#endif
+}
+
+void run(const std::string& base, int cycles) {
+  std::string aff = base + ".aff";
+  std::string dic = base + ".dic";
+  std::vector<double> times;
+  long rss_before = current_rss_kb();
+  long rss_loaded = 0;
+  for (int i = 0; i < cycles; ++i) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    Hunspell* hunspell = new Hunspell(aff.c_str(), dic.c_str());
+    times.push_back(std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+    rss_loaded = std::max(rss_loaded, current_rss_kb() - rss_before);
+    delete hunspell;
+  }
+  std::sort(times.begin(), times.end());
+  printf("%s: load min %.1f ms, median %.1f ms; rss +%ld KB loaded, "
+         "+%ld KB after %d unloads\n",
+         base.c_str(), times.front(), times[times.size() / 2], rss_loaded,
+         current_rss_kb() - rss_before, cycles);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int cycles = 5;
+  int i = 1;
+  if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+    cycles = std::max(1, atoi(argv[2]));
+    i = 3;
+  }
+  if (i >= argc) {
+    fprintf(stderr, "usage: %s [-n cycles] dictionary_without_extension...\n",
+            argv[0]);
+    return 1;
+  }
+  for (; i < argc; ++i)
+    run(argv[i], cycles);
+  printf("peak rss %ld KB\n", peak_rss_kb());
+  return 0;
+}
@@ -0,0 +1,165 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+// Measures checking of real text split into shards, one per thread, each
+// thread using its own copy of the dictionary the same way the plugin's
+// HunspellInterface::check_words_in_parallel does. Also reports how long
+// loading of a copy takes, since copies are loaded in background before
+// they are used. Build it with -DHUNSPELL_BUILD_BENCHMARK=ON and run as
+//   hunspell_parallelbench [-n cycles] [-t threads] /usr/share/hunspell/en_US text.txt
+// Text is split into words at ASCII non-letters, so it should be UTF-8 for
+// UTF-8 dictionaries.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hunspell/hunspell.hxx"
+
+namespace {
+bool is_word_byte(unsigned char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '\'' ||
+         c >= 0x80;
+}
+
+std::vector<std::string> read_words(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  std::vector<std::string> words;
+  size_t i = 0;
+  while (i < text.size()) {
+    while (i < text.size() && !is_word_byte(text[i]))
+      ++i;
+    size_t start = i;
+    while (i < text.size() && is_word_byte(text[i]))
+      ++i;
+    if (i > start)
+      words.push_back(text.substr(start, i - start));
+  }
+  return words;
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+template <typename F>
+double min_time_ms(int cycles, F f) {
+  double best = 0;
+  for (int i = 0; i < cycles; ++i) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    f();
+    double ms = elapsed_ms(start);
+    if (i == 0 || ms < best)
+      best = ms;
+  }
+  return best;
+}
+
+size_t count_misspelled(Hunspell& hunspell,
+                        const std::vector<std::string>& words,
+                        size_t begin,
+                        size_t end) {
+  size_t misspelled = 0;
+  for (size_t j = begin; j < end; ++j)
+    misspelled += hunspell.spell(words[j]) ? 0 : 1;
+  return misspelled;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int cycles = 5;
+  size_t thread_count = std::max(2u, std::thread::hardware_concurrency());
+  int i = 1;
+  while (argc - i > 2 && argv[i][0] == '-') {
+    if (strcmp(argv[i], "-n") == 0)
+      cycles = std::max(1, atoi(argv[i + 1]));
+    else if (strcmp(argv[i], "-t") == 0)
+      thread_count = std::max(1, atoi(argv[i + 1]));
+    else
+      break;
+    i += 2;
+  }
+  if (argc - i != 2) {
+    fprintf(stderr,
+            "usage: %s [-n cycles] [-t threads] dictionary_without_extension "
+            "text_file\n",
+            argv[0]);
+    return 1;
+  }
+  std::string base = argv[i];
+  std::vector<std::string> words = read_words(argv[i + 1]);
+  if (words.empty()) {
+    fprintf(stderr, "no words in %s\n", argv[i + 1]);
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<Hunspell> > copies;
+  std::chrono::steady_clock::time_point load_start =
+      std::chrono::steady_clock::now();
+  for (size_t j = 0; j < thread_count; ++j)
+    copies.push_back(std::unique_ptr<Hunspell>(
+        new Hunspell((base + ".aff").c_str(), (base + ".dic").c_str())));
+  double load_ms = elapsed_ms(load_start) / thread_count;
+
+  size_t misspelled = 0;
+  double single_ms = min_time_ms(cycles, [&]() {
+    misspelled = count_misspelled(*copies[0], words, 0, words.size());
+  });
+
+  size_t parallel_misspelled = 0;
+  double parallel_ms = min_time_ms(cycles, [&]() {
+    std::vector<size_t> shard_misspelled(thread_count);
+    std::vector<std::thread> threads;
+    // the first shard is checked by the calling thread, as in the plugin
+    for (size_t shard = 1; shard < thread_count; ++shard)
+      threads.push_back(std::thread([&, shard]() {
+        shard_misspelled[shard] = count_misspelled(
+            *copies[shard], words, words.size() * shard / thread_count,
+            words.size() * (shard + 1) / thread_count);
+      }));
+    shard_misspelled[0] = count_misspelled(*copies[0], words, 0,
+                                           words.size() / thread_count);
+    for (size_t j = 0; j < threads.size(); ++j)
+      threads[j].join();
+    parallel_misspelled = 0;
+    for (size_t j = 0; j < thread_count; ++j)
+      parallel_misspelled += shard_misspelled[j];
+  });
+  if (parallel_misspelled != misspelled) {
+    fprintf(stderr, "parallel verdicts differ from single thread ones\n");
+    return 1;
+  }
+
+  printf("%s: %zu words, %zu misspelled, %u hardware threads\n",
+         base.c_str(), words.size(), misspelled,
+         std::thread::hardware_concurrency());
+  printf("loading one copy:        %.1f ms\n", load_ms);
+  printf("single thread:           %.1f ms\n", single_ms);
+  printf("%zu threads with copies: %.1f ms, %.2fx faster\n", thread_count,
+         parallel_ms, single_ms / parallel_ms);
+  return 0;
+}
@@ -0,0 +1,141 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+// Measures how much a verdict cache in front of Hunspell::spell saves when
+// checking real text. The cache mirrors the plugin's CachingSpeller: a map
+// from word to verdict which is dropped once it holds 65536 words. Build it
+// with -DHUNSPELL_BUILD_BENCHMARK=ON and run as
+//   hunspell_spellbench [-n cycles] /usr/share/hunspell/en_US text.txt
+// Text is split into words at ASCII non-letters, so it should be UTF-8 for
+// UTF-8 dictionaries.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hunspell/hunspell.hxx"
+
+namespace {
+const size_t max_cached_word_count = 65536;
+
+bool is_word_byte(unsigned char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '\'' ||
+         c >= 0x80;
+}
+
+std::vector<std::string> read_words(const char* path) {
+  std::ifstream in(path, std::ios::binary);
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  std::vector<std::string> words;
+  size_t i = 0;
+  while (i < text.size()) {
+    while (i < text.size() && !is_word_byte(text[i]))
+      ++i;
+    size_t start = i;
+    while (i < text.size() && is_word_byte(text[i]))
+      ++i;
+    if (i > start)
+      words.push_back(text.substr(start, i - start));
+  }
+  return words;
+}
+
+template <typename F>
+double min_time_ms(int cycles, F f) {
+  double best = 0;
+  for (int i = 0; i < cycles; ++i) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    f();
+    double ms = std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+    if (i == 0 || ms < best)
+      best = ms;
+  }
+  return best;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  int cycles = 5;
+  int i = 1;
+  if (argc > 2 && strcmp(argv[1], "-n") == 0) {
+    cycles = std::max(1, atoi(argv[2]));
+    i = 3;
+  }
+  if (argc - i != 2) {
+    fprintf(stderr,
+            "usage: %s [-n cycles] dictionary_without_extension text_file\n",
+            argv[0]);
+    return 1;
+  }
+  std::string base = argv[i];
+  std::vector<std::string> words = read_words(argv[i + 1]);
+  if (words.empty()) {
+    fprintf(stderr, "no words in %s\n", argv[i + 1]);
+    return 1;
+  }
+  Hunspell hunspell((base + ".aff").c_str(), (base + ".dic").c_str());
+
+  size_t misspelled = 0;
+  double uncached_ms = min_time_ms(cycles, [&]() {
+    misspelled = 0;
+    for (size_t j = 0; j < words.size(); ++j)
+      misspelled += hunspell.spell(words[j]) ? 0 : 1;
+  });
+
+  size_t hits = 0, misses = 0, cached_misspelled = 0;
+  double cached_ms = min_time_ms(cycles, [&]() {
+    std::unordered_map<std::string, bool> verdicts;
+    hits = misses = cached_misspelled = 0;
+    for (size_t j = 0; j < words.size(); ++j) {
+      std::unordered_map<std::string, bool>::const_iterator it =
+          verdicts.find(words[j]);
+      bool verdict;
+      if (it != verdicts.end()) {
+        ++hits;
+        verdict = it->second;
+      } else {
+        ++misses;
+        verdict = hunspell.spell(words[j]);
+        if (verdicts.size() >= max_cached_word_count)
+          verdicts.clear();
+        verdicts.emplace(words[j], verdict);
+      }
+      cached_misspelled += verdict ? 0 : 1;
+    }
+  });
+  if (cached_misspelled != misspelled) {
+    fprintf(stderr, "cached verdicts differ from uncached ones\n");
+    return 1;
+  }
+
+  printf("%s: %zu words, %zu misspelled\n", base.c_str(), words.size(),
+         misspelled);
+  printf("spell() for every word: %.1f ms\n", uncached_ms);
+  printf("with verdict cache:     %.1f ms (%zu hits, %zu misses, %.1f%% hit "
+         "rate), %.1fx faster\n",
+         cached_ms, hits, misses, 100.0 * hits / words.size(),
+         uncached_ms / cached_ms);
+  return 0;
+}
@@ -93,7 +93,10 @@ static inline void HUNSPELL_WARNING(FILE*, const char*, ...) {}
 #define FLAG_NULL 0x00
 #define FREE_FLAG(a) a = 0
 
-#define TESTAFF(a, b, c) (std::binary_search(a, a + c, b))
+// `a` may be a rel_ptr from a hash entry
+#define TESTAFF(a, b, c)                                        \
+  (std::binary_search(static_cast<const unsigned short*>(a),    \
+                      static_cast<const unsigned short*>(a) + c, b))
 
 struct guessword {
   char* word;
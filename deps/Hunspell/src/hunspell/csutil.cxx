@@ -612,16 +612,18 @@ std::vector<w_char>& mkinitsmall_utf(std::vector<w_char>& u, int langnum) {
   return u;
 }
 
-// conversion function for protected memory
+// conversion function for protected memory, pointer is stored as offset
+// from `dest` like rel_ptr, so it stays valid in mapped hash table images
 void store_pointer(char* dest, char* source) {
-  memcpy(dest, &source, sizeof(char*));
+  ptrdiff_t offset = source ? source - dest : 0;
+  memcpy(dest, &offset, sizeof(offset));
 }
 
 // conversion function for protected memory
 char* get_stored_pointer(const char* s) {
-  char* p;
-  memcpy(&p, s, sizeof(char*));
-  return p;
+  ptrdiff_t offset;
+  memcpy(&offset, s, sizeof(offset));
+  return offset ? (char*)s + offset : NULL;
 }
 
 #ifndef MOZILLA_CLIENT
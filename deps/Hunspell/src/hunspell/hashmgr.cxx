@@ -73,12 +73,96 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <limits>
+#include <map>
 #include <sstream>
+#include <stddef.h>
 
 #include "hashmgr.hxx"
 #include "csutil.hxx"
 #include "atypes.hxx"
 
+namespace {
+// all pointers inside of hash table image are self-relative (see rel_ptr), so
+// it is used right where it is mapped without any relocation
+struct hash_image_header {
+  char magic[8];
+  unsigned int version;
+  unsigned int pointer_size;
+  int tablesize;
+  int numaliasf;
+  int numaliasm;
+  size_t entry_count;
+  size_t table_offset;
+  size_t image_size;
+};
+
+const char hash_image_magic[8] = {'H', 'U', 'N', 'H', 'A', 'S', 'H', '\0'};
+const unsigned int hash_image_version = 2;
+
+size_t align_offset(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) / alignment * alignment;
+}
+
+// word and description are stored right after the entry
+size_t entry_size(const struct hentry* hp) {
+  size_t word_size = strlen(hp->word) + 1;
+  size_t size = offsetof(struct hentry, word) + word_size;
+  if (hp->var & H_OPT_ALIASM)
+    size += sizeof(char*);
+  else if (hp->var & H_OPT)
+    size += strlen(hp->word + word_size) + 1;
+  return size < sizeof(struct hentry) ? sizeof(struct hentry) : size;
+}
+
+size_t flags_size(const struct hentry* hp) {
+  // at least one flag is reserved, so a non-NULL vector points inside the image
+  return (hp->alen > 0 ? hp->alen : 1) * sizeof(unsigned short);
+}
+
+// offset of the target of a self-relative pointer stored at `offset`, may be
+// anything for a corrupted image
+ptrdiff_t target_offset(size_t offset, ptrdiff_t relative) {
+  return ptrdiff_t(offset) + relative;
+}
+
+bool is_inside(ptrdiff_t offset, size_t size, size_t image_size) {
+  return offset >= 0 && size_t(offset) <= image_size &&
+         image_size - size_t(offset) >= size;
+}
+}
+
+HashArena::HashArena() : current(NULL), left(0), next_block_size(4096) {}
+
+HashArena::~HashArena() {
+  for (size_t i = 0; i < blocks.size(); ++i)
+    free(blocks[i]);
+}
+
+void* HashArena::allocate(size_t size) {
+  // entries contain pointers, so everything is aligned as one
+  size = align_offset(size, sizeof(void*));
+  if (size > left) {
+    // blocks grow with the table up to 1 MB, a few user words added later
+    // don't need much
+    const size_t max_block_size = 1 << 20;
+    size_t block_size = next_block_size;
+    if (block_size < max_block_size)
+      next_block_size *= 2;
+    if (block_size < size)
+      block_size = size;
+    char* block = (char*)malloc(block_size);
+    if (!block)
+      return NULL;
+    blocks.push_back(block);
+    current = block;
+    left = block_size;
+  }
+  void* p = current;
+  current += size;
+  left -= size;
+  return p;
+}
+
 // build a hash table from a munched word list
 
 HashMgr::HashMgr(const char* tpath, const char* apath, const char* key)
@@ -93,7 +177,9 @@ HashMgr::HashMgr(const char* tpath, const char* apath, const char* key)
       aliasf(NULL),
       aliasflen(0),
       numaliasm(0),
-      aliasm(NULL) {
+      aliasm(NULL),
+      image(NULL),
+      image_size(0) {
   langnum = 0;
   csconv = 0;
   load_config(apath, key);
@@ -104,31 +190,51 @@ HashMgr::HashMgr(const char* tpath, const char* apath, const char* key)
     free(tableptr);
     //keep tablesize to 1 to fix possible division with zero
     tablesize = 1;
-    tableptr = (struct hentry**)calloc(tablesize, sizeof(struct hentry*));
+    tableptr = (rel_ptr<struct hentry>*)calloc(tablesize,
+                                               sizeof(rel_ptr<struct hentry>));
     if (!tableptr) {
       tablesize = 0;
     }
   }
 }
 
-HashMgr::~HashMgr() {
-  if (tableptr) {
-    // now pass through hash table freeing up everything
-    // go through column by column of the table
-    for (int i = 0; i < tablesize; i++) {
-      struct hentry* pt = tableptr[i];
-      struct hentry* nt = NULL;
-      while (pt) {
-        nt = pt->next;
-        if (pt->astr &&
-            (!aliasf || TESTAFF(pt->astr, ONLYUPCASEFLAG, pt->alen)))
-          free(pt->astr);
-        free(pt);
-        pt = nt;
-      }
+// use a hash table saved by save_image()
+HashMgr::HashMgr(char* data, size_t size, const char* apath, const char* key)
+    : tablesize(0),
+      tableptr(NULL),
+      flag_mode(FLAG_CHAR),
+      complexprefixes(0),
+      utf8(0),
+      forbiddenword(FORBIDDENWORD)  // forbidden word signing flag
+      ,
+      numaliasf(0),
+      aliasf(NULL),
+      aliasflen(0),
+      numaliasm(0),
+      aliasm(NULL),
+      image(NULL),
+      image_size(0) {
+  langnum = 0;
+  csconv = 0;
+  load_config(apath, key);
+  int ec = load_image(data, size);
+  if (ec) {
+    HUNSPELL_WARNING(stderr, "Hash Manager Image Error : %d\n", ec);
+    image = NULL;
+    image_size = 0;
+    tablesize = 1;
+    tableptr = (rel_ptr<struct hentry>*)calloc(tablesize,
+                                               sizeof(rel_ptr<struct hentry>));
+    if (!tableptr) {
+      tablesize = 0;
     }
-    free(tableptr);
   }
+}
+
+HashMgr::~HashMgr() {
+  // entries and their flag vectors are owned by the arena or the image
+  if (tableptr && !is_in_image(tableptr))
+    free(tableptr);
   tablesize = 0;
 
   if (aliasf) {
@@ -224,8 +330,8 @@ int HashMgr::add_word(const std::string& in_word,
   bool upcasehomonym = false;
   int descl = desc ? (aliasm ? sizeof(char*) : desc->size() + 1) : 0;
   // variable-length hash record with word and optional fields
-  struct hentry* hp =
-      (struct hentry*)malloc(sizeof(struct hentry) + word->size() + descl);
+  struct hentry* hp = (struct hentry*)arena.allocate(sizeof(struct hentry) +
+                                                     word->size() + descl);
   if (!hp) {
     delete desc_copy;
     delete word_copy;
@@ -270,10 +376,8 @@ int HashMgr::add_word(const std::string& in_word,
       // remove hidden onlyupcase homonym
       if (!onlyupcase) {
         if ((dp->astr) && TESTAFF(dp->astr, ONLYUPCASEFLAG, dp->alen)) {
-          free(dp->astr);
           dp->astr = hp->astr;
           dp->alen = hp->alen;
-          free(hp);
           delete desc_copy;
           delete word_copy;
           return 0;
@@ -290,10 +394,8 @@ int HashMgr::add_word(const std::string& in_word,
     // remove hidden onlyupcase homonym
     if (!onlyupcase) {
       if ((dp->astr) && TESTAFF(dp->astr, ONLYUPCASEFLAG, dp->alen)) {
-        free(dp->astr);
         dp->astr = hp->astr;
         dp->alen = hp->alen;
-        free(hp);
         delete desc_copy;
         delete word_copy;
         return 0;
@@ -304,14 +406,10 @@ int HashMgr::add_word(const std::string& in_word,
       upcasehomonym = true;
     }
   }
-  if (!upcasehomonym) {
+  // otherwise hidden onlyupcase homonym is dropped, its memory stays in
+  // the arena
+  if (!upcasehomonym)
     dp->next = hp;
-  } else {
-    // remove hidden onlyupcase homonym
-    if (hp->astr)
-      free(hp->astr);
-    free(hp);
-  }
 
   delete desc_copy;
   delete word_copy;
@@ -333,8 +431,7 @@ int HashMgr::add_hidden_capitalized_word(const std::string& word,
   if (((captype == HUHCAP) || (captype == HUHINITCAP) ||
        ((captype == ALLCAP) && (flagslen != 0))) &&
       !((flagslen != 0) && TESTAFF(flags, forbiddenword, flagslen))) {
-    unsigned short* flags2 =
-        (unsigned short*)malloc(sizeof(unsigned short) * (flagslen + 1));
+    unsigned short* flags2 = allocate_flags(flagslen + 1);
     if (!flags2)
       return 1;
     if (flagslen)
@@ -382,14 +479,12 @@ int HashMgr::remove(const std::string& word) {
   struct hentry* dp = lookup(word.c_str());
   while (dp) {
     if (dp->alen == 0 || !TESTAFF(dp->astr, forbiddenword, dp->alen)) {
-      unsigned short* flags =
-          (unsigned short*)malloc(sizeof(unsigned short) * (dp->alen + 1));
+      unsigned short* flags = allocate_flags(dp->alen + 1);
       if (!flags)
         return 1;
       for (int i = 0; i < dp->alen; i++)
         flags[i] = dp->astr[i];
       flags[dp->alen] = forbiddenword;
-      free(dp->astr);
       dp->astr = flags;
       dp->alen++;
       std::sort(flags, flags + dp->alen);
@@ -409,8 +504,7 @@ int HashMgr::remove_forbidden_flag(const std::string& word) {
       if (dp->alen == 1)
         dp->alen = 0;  // XXX forbidden words of personal dic.
       else {
-        unsigned short* flags2 =
-            (unsigned short*)malloc(sizeof(unsigned short) * (dp->alen - 1));
+        unsigned short* flags2 = allocate_flags(dp->alen - 1);
         if (!flags2)
           return 1;
         int i, j = 0;
@@ -419,7 +513,6 @@ int HashMgr::remove_forbidden_flag(const std::string& word) {
             flags2[j++] = dp->astr[i];
         }
         dp->alen--;
-        free(dp->astr);
         dp->astr = flags2;  // XXX allowed forbidden words
       }
     }
@@ -452,8 +545,7 @@ int HashMgr::add_with_affix(const std::string& word, const std::string& example)
     if (aliasf) {
       add_word(word, wcl, dp->astr, dp->alen, NULL, false);
     } else {
-      unsigned short* flags =
-          (unsigned short*)malloc(dp->alen * sizeof(unsigned short));
+      unsigned short* flags = allocate_flags(dp->alen);
       if (flags) {
         memcpy((void*)flags, (void*)dp->astr,
                dp->alen * sizeof(unsigned short));
@@ -467,6 +559,31 @@ int HashMgr::add_with_affix(const std::string& word, const std::string& example)
   return 1;
 }
 
+// add a custom dic. word with affix flags written the same way as in
+// dictionary files, i.e. the part after '/' or flag vector alias (public)
+int HashMgr::add_with_flags(const std::string& word, const std::string& flags) {
+  unsigned short* ap = NULL;
+  int al = 0;
+  if (aliasf) {
+    al = get_aliasf(atoi(flags.c_str()), &ap, NULL);
+  } else {
+    std::vector<unsigned short> flagbuf;
+    decode_flags(flagbuf, flags, NULL);
+    al = (int)flagbuf.size();
+    ap = al ? allocate_flags(al) : NULL;
+    if (al && !ap)
+      return 1;
+    std::sort(flagbuf.begin(), flagbuf.end());
+    if (al)
+      memcpy(ap, &flagbuf[0], al * sizeof(unsigned short));
+  }
+  int captype;
+  int wcl = get_clen_and_captype(word, &captype);
+  if (add_word(word, wcl, ap, al, NULL, false))
+    return 1;
+  return add_hidden_capitalized_word(word, wcl, ap, al, NULL, captype);
+}
+
 // walk the hash table entry by entry - null at end
 // initialize: col=-1; hp = NULL; hp = walk_hashtable(&col, hp);
 struct hentry* HashMgr::walk_hashtable(int& col, struct hentry* hp) const {
@@ -519,7 +636,8 @@ int HashMgr::load_tables(const char* tpath, const char* key) {
     tablesize++;
 
   // allocate the hash table
-  tableptr = (struct hentry**)calloc(tablesize, sizeof(struct hentry*));
+  tableptr = (rel_ptr<struct hentry>*)calloc(tablesize,
+                                             sizeof(rel_ptr<struct hentry>));
   if (!tableptr) {
     delete dict;
     return 3;
@@ -529,6 +647,7 @@ int HashMgr::load_tables(const char* tpath, const char* key) {
   // table and create word and affix strings
 
   std::vector<w_char> workbuf;
+  std::vector<unsigned short> flagbuf;
 
   while (dict->getline(ts)) {
     mychomp(ts);
@@ -588,13 +707,18 @@ int HashMgr::load_tables(const char* tpath, const char* key) {
                            dict->getlinenum());
         }
       } else {
-        al = decode_flags(&flags, ap.c_str(), dict);
-        if (al == -1) {
+        flagbuf.clear();
+        decode_flags(flagbuf, ap, dict);
+        al = (int)flagbuf.size();
+        flags = al ? allocate_flags(al) : NULL;
+        if (al && !flags) {
           HUNSPELL_WARNING(stderr, "Can't allocate memory.\n");
           delete dict;
           return 6;
         }
-        std::sort(flags, flags + al);
+        std::sort(flagbuf.begin(), flagbuf.end());
+        if (al)
+          memcpy(flags, &flagbuf[0], al * sizeof(unsigned short));
       }
     } else {
       al = 0;
@@ -616,6 +740,186 @@ int HashMgr::load_tables(const char* tpath, const char* key) {
   return 0;
 }
 
+bool HashMgr::save_image(std::vector<char>& result) const {
+  if (!tableptr)
+    return false;
+  // entries are followed by their flag vectors, vectors and morphological
+  // descriptions shared by several entries (aliases) are stored once
+  size_t table_offset =
+      align_offset(sizeof(hash_image_header), sizeof(struct hentry*));
+  size_t size = table_offset + tablesize * sizeof(rel_ptr<struct hentry>);
+  std::map<const struct hentry*, size_t> entry_offsets;
+  std::map<const unsigned short*, size_t> flags_offsets;
+  std::map<const char*, size_t> morph_offsets;
+  int col = -1;
+  for (struct hentry* hp = walk_hashtable(col, NULL); hp;
+       hp = walk_hashtable(col, hp)) {
+    size = align_offset(size, sizeof(struct hentry*));
+    entry_offsets[hp] = size;
+    size += entry_size(hp);
+    if (hp->astr && !flags_offsets.count(hp->astr)) {
+      size = align_offset(size, sizeof(unsigned short));
+      flags_offsets[hp->astr] = size;
+      size += flags_size(hp);
+    }
+    if (hp->var & H_OPT_ALIASM) {
+      const char* morph = HENTRY_DATA(hp);
+      if (morph && !morph_offsets.count(morph)) {
+        morph_offsets[morph] = size;
+        size += strlen(morph) + 1;
+      }
+    }
+  }
+
+  result.assign(size, 0);
+  char* data = &result[0];
+  hash_image_header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, hash_image_magic, sizeof(header.magic));
+  header.version = hash_image_version;
+  header.pointer_size = sizeof(void*);
+  header.tablesize = tablesize;
+  header.numaliasf = numaliasf;
+  header.numaliasm = numaliasm;
+  header.entry_count = entry_offsets.size();
+  header.table_offset = table_offset;
+  header.image_size = size;
+  memcpy(data, &header, sizeof(header));
+
+  // relative pointers are assigned at their final places inside of `data`
+  rel_ptr<struct hentry>* table = (rel_ptr<struct hentry>*)(data + table_offset);
+  for (int i = 0; i < tablesize; i++)
+    table[i] = tableptr[i] ? (struct hentry*)(data + entry_offsets[tableptr[i]])
+                           : NULL;
+  for (std::map<const struct hentry*, size_t>::const_iterator it =
+           entry_offsets.begin();
+       it != entry_offsets.end(); ++it) {
+    const struct hentry* hp = it->first;
+    struct hentry* copy = (struct hentry*)(data + it->second);
+    // raw copy of scalar fields and the word, relative pointers copied this
+    // way are wrong and are assigned below
+    memcpy((void*)copy, (const void*)hp, entry_size(hp));
+    copy->next =
+        hp->next ? (struct hentry*)(data + entry_offsets[hp->next]) : NULL;
+    copy->next_homonym =
+        hp->next_homonym
+            ? (struct hentry*)(data + entry_offsets[hp->next_homonym])
+            : NULL;
+    copy->astr = NULL;
+    if (hp->astr) {
+      unsigned short* flags =
+          (unsigned short*)(data + flags_offsets[hp->astr]);
+      memcpy(flags, hp->astr, hp->alen * sizeof(unsigned short));
+      copy->astr = flags;
+    }
+    if (hp->var & H_OPT_ALIASM) {
+      char* dp = copy->word + strlen(copy->word) + 1;
+      const char* morph = HENTRY_DATA(hp);
+      char* morph_copy = NULL;
+      if (morph) {
+        morph_copy = data + morph_offsets[morph];
+        strcpy(morph_copy, morph);
+      }
+      store_pointer(dp, morph_copy);
+    }
+  }
+  return true;
+}
+
+bool HashMgr::is_image_loaded() const {
+  return image != NULL;
+}
+
+// check hash table image and use it as is, it is unusable if an error is
+// returned
+int HashMgr::load_image(char* data, size_t size) {
+  hash_image_header header;
+  if (size < sizeof(header))
+    return 1;
+  memcpy(&header, data, sizeof(header));
+  if (memcmp(header.magic, hash_image_magic, sizeof(header.magic)) != 0 ||
+      header.version != hash_image_version ||
+      header.pointer_size != sizeof(void*) || header.image_size != size)
+    return 2;
+  // image made with different affix file
+  if (header.numaliasf != numaliasf || header.numaliasm != numaliasm)
+    return 3;
+  if (header.tablesize <= 0 ||
+      header.table_offset % sizeof(struct hentry*) != 0 ||
+      header.table_offset > size ||
+      (size - header.table_offset) / sizeof(rel_ptr<struct hentry>) <
+          size_t(header.tablesize))
+    return 4;
+
+  // pointers are only read here, so pages of the image stay shared
+  rel_ptr<struct hentry>* table =
+      (rel_ptr<struct hentry>*)(data + header.table_offset);
+  size_t entry_count = 0;
+  for (int i = 0; i < header.tablesize; i++) {
+    const rel_ptr<struct hentry>* link = &table[i];
+    while (true) {
+      size_t link_offset = (const char*)link - data;
+      ptrdiff_t relative;
+      memcpy(&relative, link, sizeof(relative));
+      if (!relative)
+        break;
+      ptrdiff_t offset = target_offset(link_offset, relative);
+      if (++entry_count > header.entry_count ||
+          offset % sizeof(struct hentry*) != 0 ||
+          !is_inside(offset, sizeof(struct hentry), size))
+        return 5;
+      const struct hentry* hp = (const struct hentry*)(data + offset);
+      const char* word_end = (const char*)memchr(
+          hp->word, '\0', size - (offset + offsetof(struct hentry, word)));
+      if (!word_end)
+        return 6;
+      size_t data_offset = word_end + 1 - data;
+      if (hp->var & H_OPT_ALIASM) {
+        if (!is_inside(data_offset, sizeof(char*), size))
+          return 7;
+        memcpy(&relative, data + data_offset, sizeof(relative));
+        ptrdiff_t morph_offset = target_offset(data_offset, relative);
+        if (relative && (!is_inside(morph_offset, 1, size) ||
+                         !memchr(data + morph_offset, '\0',
+                                 size - morph_offset)))
+          return 7;
+      } else if (hp->var & H_OPT) {
+        if (data_offset >= size ||
+            !memchr(data + data_offset, '\0', size - data_offset))
+          return 7;
+      }
+      size_t field_offset = offset + offsetof(struct hentry, astr);
+      memcpy(&relative, data + field_offset, sizeof(relative));
+      ptrdiff_t flags_offset = target_offset(field_offset, relative);
+      if (relative && (flags_offset % sizeof(unsigned short) != 0 ||
+                       !is_inside(flags_offset, flags_size(hp), size)))
+        return 8;
+      // homonyms are the following entries of the same chain, so only
+      // pointers to them are checked
+      field_offset = offset + offsetof(struct hentry, next_homonym);
+      memcpy(&relative, data + field_offset, sizeof(relative));
+      ptrdiff_t homonym_offset = target_offset(field_offset, relative);
+      if (relative && (homonym_offset % sizeof(struct hentry*) != 0 ||
+                       !is_inside(homonym_offset, sizeof(struct hentry), size)))
+        return 5;
+      link = &hp->next;
+    }
+  }
+  image = data;
+  image_size = size;
+  tablesize = header.tablesize;
+  tableptr = table;
+  return 0;
+}
+
+bool HashMgr::is_in_image(const void* p) const {
+  return image && (const char*)p >= image && (const char*)p < image + image_size;
+}
+
+unsigned short* HashMgr::allocate_flags(int count) {
+  return (unsigned short*)arena.allocate(count * sizeof(unsigned short));
+}
+
 // the hash function is a simple load and rotate
 // algorithm borrowed
 int HashMgr::hash(const char* word) const {
@@ -725,7 +1029,7 @@ bool HashMgr::decode_flags(std::vector<unsigned short>& result, const std::strin
       size_t len = flags.size();
       if (len % 2 == 1)
         HUNSPELL_WARNING(stderr, "error: line %d: bad flagvector\n",
-                         af->getlinenum());
+                         af ? af->getlinenum() : 0);
       len /= 2;
       result.reserve(result.size() + len);
       for (size_t i = 0; i < len; ++i) {
@@ -743,11 +1047,11 @@ bool HashMgr::decode_flags(std::vector<unsigned short>& result, const std::strin
           if (i >= DEFAULTFLAGS)
             HUNSPELL_WARNING(
                 stderr, "error: line %d: flag id %d is too large (max: %d)\n",
-                af->getlinenum(), i, DEFAULTFLAGS - 1);
+                af ? af->getlinenum() : 0, i, DEFAULTFLAGS - 1);
           result.push_back((unsigned short)i);
           if (result.back() == 0)
             HUNSPELL_WARNING(stderr, "error: line %d: 0 is wrong flag id\n",
-                             af->getlinenum());
+                             af ? af->getlinenum() : 0);
           src = p + 1;
         }
       }
@@ -755,11 +1059,11 @@ bool HashMgr::decode_flags(std::vector<unsigned short>& result, const std::strin
       if (i >= DEFAULTFLAGS)
         HUNSPELL_WARNING(stderr,
                          "error: line %d: flag id %d is too large (max: %d)\n",
-                         af->getlinenum(), i, DEFAULTFLAGS - 1);
+                         af ? af->getlinenum() : 0, i, DEFAULTFLAGS - 1);
       result.push_back((unsigned short)i);
       if (result.back() == 0)
         HUNSPELL_WARNING(stderr, "error: line %d: 0 is wrong flag id\n",
-                         af->getlinenum());
+                         af ? af->getlinenum() : 0);
       break;
     }
     case FLAG_UNI: {  // UTF-8 characters
@@ -1075,7 +1379,7 @@ int HashMgr::get_aliasf(int index, unsigned short** fvec, FileMgr* af) const {
     return aliasflen[index - 1];
   }
   HUNSPELL_WARNING(stderr, "error: line %d: bad flag alias index: %d\n",
-                   af->getlinenum(), index);
+                   af ? af->getlinenum() : 0, index);
   *fvec = NULL;
   return 0;
 }
@@ -81,9 +81,29 @@
 
 enum flag { FLAG_CHAR, FLAG_LONG, FLAG_NUM, FLAG_UNI };
 
+// bump allocator for hash entries (with their words) and flag vectors, which
+// all live as long as the hash table, so they are released in one go instead
+// of hundreds of thousands of separate heap blocks
+class HashArena {
+  std::vector<char*> blocks;
+  char* current;
+  size_t left;
+  size_t next_block_size;
+
+ public:
+  HashArena();
+  ~HashArena();
+  void* allocate(size_t size);
+
+ private:
+  // not implemented
+  HashArena(const HashArena&);
+  HashArena& operator=(const HashArena&);
+};
+
 class HashMgr {
   int tablesize;
-  struct hentry** tableptr;
+  rel_ptr<struct hentry>* tableptr;
   flag flag_mode;
   int complexprefixes;
   int utf8;
@@ -99,9 +119,18 @@ class HashMgr {
   unsigned short* aliasflen;
   int numaliasm;  // morphological desciption `compression' with aliases
   char** aliasm;
+  char* image;  // memory holding the hash table if it was loaded by load_image()
+  size_t image_size;
+  HashArena arena;  // owns all entries and flag vectors not in the image
 
  public:
   HashMgr(const char* tpath, const char* apath, const char* key = NULL);
+  // use hash table image made by save_image() of HashMgr with the same affix
+  // file as is, it is written to only when words are added or removed (so a
+  // copy-on-write mapping is enough) and should stay alive until destruction,
+  // the table is empty if image is invalid
+  HashMgr(char* image, size_t image_size, const char* apath,
+          const char* key = NULL);
   ~HashMgr();
 
   struct hentry* lookup(const char*) const;
@@ -110,6 +139,7 @@ class HashMgr {
 
   int add(const std::string& word);
   int add_with_affix(const std::string& word, const std::string& pattern);
+  int add_with_flags(const std::string& word, const std::string& flags);
   int remove(const std::string& word);
   int decode_flags(unsigned short** result, const std::string& flags, FileMgr* af) const;
   bool decode_flags(std::vector<unsigned short>& result, const std::string& flags, FileMgr* af) const;
@@ -119,11 +149,18 @@ class HashMgr {
   int get_aliasf(int index, unsigned short** fvec, FileMgr* af) const;
   int is_aliasm() const;
   char* get_aliasm(int index) const;
+  // serialize the hash table into a single block of memory with
+  // self-relative pointers, suitable for storing in a file
+  bool save_image(std::vector<char>& result) const;
+  bool is_image_loaded() const;
 
  private:
   int get_clen_and_captype(const std::string& word, int* captype);
   int get_clen_and_captype(const std::string& word, int* captype, std::vector<w_char> &workbuf);
   int load_tables(const char* tpath, const char* key);
+  int load_image(char* data, size_t size);
+  bool is_in_image(const void* p) const;
+  unsigned short* allocate_flags(int count);
   int add_word(const std::string& word,
                int wcl,
                unsigned short* ap,
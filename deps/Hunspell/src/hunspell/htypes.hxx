@@ -38,6 +38,8 @@
 #ifndef HTYPES_HXX_
 #define HTYPES_HXX_
 
+#include <stddef.h>
+
 #define ROTATE_LEN 5
 
 #define ROTATE(v, q) \
@@ -54,13 +56,41 @@
 // approx. number  of user defined words
 #define USERWORD 1000
 
+// pointer stored as offset from its own address, so hash table images stay
+// valid wherever they are mapped and are used without relocation, 0 stands
+// for NULL. Copying keeps the target, not the offset.
+template <typename T>
+class rel_ptr {
+ public:
+  rel_ptr() : offset(0) {}
+  rel_ptr(T* p) { set(p); }
+  rel_ptr(const rel_ptr& other) { set(other.get()); }
+  rel_ptr& operator=(const rel_ptr& other) {
+    set(other.get());
+    return *this;
+  }
+  rel_ptr& operator=(T* p) {
+    set(p);
+    return *this;
+  }
+  T* get() const {
+    return offset ? (T*)((char*)this + offset) : NULL;
+  }
+  operator T*() const { return get(); }
+  T* operator->() const { return get(); }
+
+ private:
+  void set(T* p) { offset = p ? (char*)p - (char*)this : 0; }
+  ptrdiff_t offset;
+};
+
 struct hentry {
   unsigned char blen;    // word length in bytes
   unsigned char clen;    // word length in characters (different for UTF-8 enc.)
   short alen;            // length of affix flag vector
-  unsigned short* astr;  // affix flag vector
-  struct hentry* next;   // next word with same hash code
-  struct hentry* next_homonym;  // next homonym word (with same hash code)
+  rel_ptr<unsigned short> astr;  // affix flag vector
+  rel_ptr<struct hentry> next;   // next word with same hash code
+  rel_ptr<struct hentry> next_homonym;  // next homonym word (with same hash code)
   char var;      // variable fields (only for special pronounciation yet)
   char word[1];  // variable-length word (8-bit or UTF-8 encoding)
 };
@@ -86,9 +86,11 @@
 class HunspellImpl
 {
 public:
-  HunspellImpl(const char* affpath, const char* dpath, const char* key);
+  HunspellImpl(const char* affpath, HashMgr* hash_mgr, const char* key);
   ~HunspellImpl();
   int add_dic(const char* dpath, const char* key);
+  bool save_hash_image(std::vector<char>& image) const;
+  bool is_hash_image_loaded() const;
   std::vector<std::string> suffix_suggest(const std::string& root_word);
   std::vector<std::string> generate(const std::string& word, const std::vector<std::string>& pl);
   std::vector<std::string> generate(const std::string& word, const std::string& pattern);
@@ -104,6 +106,7 @@ public:
   const std::string& get_dict_encoding() const;
   int add(const std::string& word);
   int add_with_affix(const std::string& word, const std::string& example);
+  int add_with_flags(const std::string& word, const std::string& flags);
   int remove(const std::string& word);
   const std::string& get_version() const;
   struct cs_info* get_csconv();
@@ -151,17 +154,21 @@ private:
 };
 
 Hunspell::Hunspell(const char* affpath, const char* dpath, const char* key)
-  : m_Impl(new HunspellImpl(affpath, dpath, key)) {
+  : m_Impl(new HunspellImpl(affpath, new HashMgr(dpath, affpath, key), key)) {
 }
 
-HunspellImpl::HunspellImpl(const char* affpath, const char* dpath, const char* key) {
+Hunspell::Hunspell(const char* affpath, char* hash_image, size_t hash_image_size, const char* key)
+  : m_Impl(new HunspellImpl(affpath, new HashMgr(hash_image, hash_image_size, affpath, key), key)) {
+}
+
+HunspellImpl::HunspellImpl(const char* affpath, HashMgr* hash_mgr, const char* key) {
   csconv = NULL;
   utf8 = 0;
   complexprefixes = 0;
   affixpath = mystrdup(affpath);
 
   /* first set up the hash manager */
-  m_HMgrs.push_back(new HashMgr(dpath, affpath, key));
+  m_HMgrs.push_back(hash_mgr);
 
   /* next set up the affix manager */
   /* it needs access to the hash manager lookup methods */
@@ -220,6 +227,22 @@ int HunspellImpl::add_dic(const char* dpath, const char* key) {
   return 0;
 }
 
+bool Hunspell::save_hash_image(std::vector<char>& image) const {
+  return m_Impl->save_hash_image(image);
+}
+
+bool HunspellImpl::save_hash_image(std::vector<char>& image) const {
+  return m_HMgrs[0]->save_image(image);
+}
+
+bool Hunspell::is_hash_image_loaded() const {
+  return m_Impl->is_hash_image_loaded();
+}
+
+bool HunspellImpl::is_hash_image_loaded() const {
+  return m_HMgrs[0]->is_image_loaded();
+}
+
 // make a copy of src at destination while removing all leading
 // blanks and removing any trailing periods after recording
 // their presence with the abbreviation flag
@@ -1318,6 +1341,16 @@ int HunspellImpl::add_with_affix(const std::string& word, const std::string& exa
   return 0;
 }
 
+int Hunspell::add_with_flags(const std::string& word, const std::string& flags) {
+  return m_Impl->add_with_flags(word, flags);
+}
+
+int HunspellImpl::add_with_flags(const std::string& word, const std::string& flags) {
+  if (!m_HMgrs.empty())
+    return m_HMgrs[0]->add_with_flags(word, flags);
+  return 0;
+}
+
 int Hunspell::remove(const std::string& word) {
   return m_Impl->remove(word);
 }
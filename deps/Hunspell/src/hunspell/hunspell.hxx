@@ -113,8 +113,22 @@ class LIBHUNSPELL_DLL_EXPORTED Hunspell {
    * with system-dependent character encoding instead of _wfopen()).
    */
   Hunspell(const char* affpath, const char* dpath, const char* key = NULL);
+  /* Hunspell(aff, image, size) - constructor taking the dictionary hash
+   * table from image made by save_hash_image() with the same affix file.
+   * Image is used where it is, it is written to only when words are added
+   * or removed and should outlive the object, check is_hash_image_loaded()
+   * to find out if it was accepted.
+   */
+  Hunspell(const char* affpath, char* hash_image, size_t hash_image_size,
+           const char* key = NULL);
   ~Hunspell();
 
+  /* save_hash_image(image) - serialize hash table of the dictionary
+   * (without extra dictionaries) into a position-independent image
+   */
+  bool save_hash_image(std::vector<char>& image) const;
+  bool is_hash_image_loaded() const;
+
   /* load extra dictionaries (only dic files) */
   int add_dic(const char* dpath, const char* key = NULL);
 
@@ -203,6 +217,12 @@ class LIBHUNSPELL_DLL_EXPORTED Hunspell {
 
   int add_with_affix(const std::string& word, const std::string& example);
 
+  /* add word to the run-time dictionary with affix flags written
+   * as in dictionary files (flags after '/' or flag vector alias)
+   */
+
+  int add_with_flags(const std::string& word, const std::string& flags);
+
   /* remove word from the run-time dictionary */
 
   int remove(const std::string& word);
@@ -0,0 +1,91 @@
+# Generates src/common/CaseData.h from Unicode Character Database files:
+#   python generate_case_data.py <version> UnicodeData.txt DerivedCoreProperties.txt
+# Files are available at https://www.unicode.org/Public/<version>/ucd/
+import os
+import re
+import sys
+
+script_dir = os.path.dirname(os.path.realpath(__file__))
+output_path = os.path.join(script_dir, 'src/common/CaseData.h')
+
+bmp_size = 0x10000
+upper_kind = 1
+lower_kind = 2
+
+property_re = re.compile(r'^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)')
+
+
+def read_mappings(path):
+    upper = {}
+    lower = {}
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            fields = line.split(';')
+            c = int(fields[0], 16)
+            if c >= bmp_size:
+                continue
+            for mapping, field in ((upper, fields[12]), (lower, fields[13])):
+                # mappings out of BMP can't be represented by a single UTF-16 code unit
+                if field and int(field, 16) < bmp_size:
+                    mapping[c] = int(field, 16)
+    return upper, lower
+
+
+def read_kinds(path):
+    kinds = {}
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            m = property_re.match(line)
+            if not m or m.group(3) not in ('Uppercase', 'Lowercase'):
+                continue
+            first = int(m.group(1), 16)
+            last = int(m.group(2), 16) if m.group(2) else first
+            for c in range(first, min(last + 1, bmp_size)):
+                assert c not in kinds, 'character is both uppercase and lowercase'
+                kinds[c] = upper_kind if m.group(3) == 'Uppercase' else lower_kind
+    return kinds
+
+
+def main():
+    version, unicode_data_path, derived_properties_path = sys.argv[1:4]
+    upper, lower = read_mappings(unicode_data_path)
+    kinds = read_kinds(derived_properties_path)
+
+    records = [(0, 0, 0)]
+    record_indices = {records[0]: 0}
+    ranges = []
+    for c in range(bmp_size):
+        record = (kinds.get(c, 0), upper.get(c, c) - c, lower.get(c, c) - c)
+        if record not in record_indices:
+            record_indices[record] = len(records)
+            records.append(record)
+        index = record_indices[record]
+        if index == 0:
+            continue
+        if ranges and ranges[-1][1] == c - 1 and ranges[-1][2] == index:
+            ranges[-1][1] = c
+        else:
+            ranges.append([c, c, index])
+
+    kind_names = {0: 'none', upper_kind: 'upper', lower_kind: 'lower'}
+    with open(output_path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('// Generated by generate_case_data.py from UnicodeData.txt and DerivedCoreProperties.txt of Unicode {}, do not edit\n'.format(version))
+        f.write('#pragma once\n\n')
+        f.write('#include "CaseTables.h"\n\n')
+        f.write('namespace case_data {\n')
+        f.write('using enum CaseKind;\n\n')
+        f.write('// Distinct combinations of Uppercase/Lowercase properties and offsets to simple case mappings\n')
+        f.write('constexpr CaseRecord records[] = {\n')
+        for i in range(0, len(records), 4):
+            f.write('  ' + ' '.join('{{{}, {}, {}}},'.format(kind_names[r[0]], r[1], r[2]) for r in records[i:i + 4]) + '\n')
+        f.write('};\n\n')
+        f.write('// Sorted non-overlapping ranges of BMP code points sharing a record, ones absent here use records[0]\n')
+        f.write('constexpr CaseRange ranges[] = {\n')
+        for i in range(0, len(ranges), 4):
+            f.write('  ' + ' '.join('{{0x{:04X}, 0x{:04X}, {}}},'.format(*r) for r in ranges[i:i + 4]) + '\n')
+        f.write('};\n')
+        f.write('} // namespace case_data\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,80 @@
+# Generates src/common/WordBreakData.h from Unicode Character Database files:
+#   python generate_word_break_data.py <version> WordBreakProperty.txt emoji-data.txt
+# Files are available at https://www.unicode.org/Public/<version>/ucd/auxiliary/ and https://www.unicode.org/Public/<version>/ucd/emoji/
+import os
+import re
+import sys
+
+script_dir = os.path.dirname(os.path.realpath(__file__))
+output_path = os.path.join(script_dir, 'src/common/WordBreakData.h')
+
+property_names = {
+    'CR': 'cr',
+    'LF': 'lf',
+    'Newline': 'newline',
+    'Extend': 'extend',
+    'ZWJ': 'zwj',
+    'Regional_Indicator': 'regional_indicator',
+    'Format': 'format',
+    'Katakana': 'katakana',
+    'Hebrew_Letter': 'hebrew_letter',
+    'ALetter': 'a_letter',
+    'Single_Quote': 'single_quote',
+    'Double_Quote': 'double_quote',
+    'MidNumLet': 'mid_num_let',
+    'MidLetter': 'mid_letter',
+    'MidNum': 'mid_num',
+    'Numeric': 'numeric',
+    'ExtendNumLet': 'extend_num_let',
+    'WSegSpace': 'w_seg_space',
+    'Extended_Pictographic': 'extended_pictographic',
+}
+
+line_re = re.compile(r'^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)')
+
+
+def read_ranges(path, wanted):
+    with open(path, encoding='utf-8') as f:
+        for line in f:
+            m = line_re.match(line)
+            if m and m.group(3) in wanted:
+                first = int(m.group(1), 16)
+                last = int(m.group(2), 16) if m.group(2) else first
+                yield first, last, property_names[m.group(3)]
+
+
+def main():
+    version, word_break_path, emoji_data_path = sys.argv[1:4]
+    properties = {}
+    # Word_Break value wins, Extended_Pictographic is only interesting for characters which have none (rule WB3c)
+    for first, last, name in read_ranges(emoji_data_path, {'Extended_Pictographic'}):
+        for c in range(first, last + 1):
+            properties[c] = name
+    word_break_names = set(property_names) - {'Extended_Pictographic'}
+    for first, last, name in read_ranges(word_break_path, word_break_names):
+        for c in range(first, last + 1):
+            properties[c] = name
+
+    ranges = []
+    for c in sorted(properties):
+        if ranges and ranges[-1][1] == c - 1 and ranges[-1][2] == properties[c]:
+            ranges[-1][1] = c
+        else:
+            ranges.append([c, c, properties[c]])
+
+    with open(output_path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('// Generated by generate_word_break_data.py from WordBreakProperty.txt and emoji-data.txt of Unicode {}, do not edit\n'.format(version))
+        f.write('#pragma once\n\n')
+        f.write('#include "WordBoundaryTokenizer.h"\n\n')
+        f.write('namespace word_break_data {\n')
+        f.write('using enum WordBreakProperty;\n\n')
+        f.write('// Sorted non-overlapping ranges of code points, ones absent here are `other`\n')
+        f.write('constexpr WordBreakRange ranges[] = {\n')
+        for i in range(0, len(ranges), 4):
+            f.write('  ' + ' '.join('{{0x{:04X}, 0x{:04X}, {}}},'.format(*r) for r in ranges[i:i + 4]) + '\n')
+        f.write('};\n')
+        f.write('} // namespace word_break_data\n')
+
+
+if __name__ == '__main__':
+    main()
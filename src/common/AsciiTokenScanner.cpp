@@ -0,0 +1,135 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "AsciiTokenScanner.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ASCII_SCAN_AVX2
+#elif defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define ASCII_SCAN_SSE2
+#endif
+
+namespace {
+constexpr uint32_t ascii_limit = 0x80;
+// vector code relies on UTF-16 code units
+constexpr bool vectorization_possible = sizeof(wchar_t) == 2;
+
+uint32_t bit_if(bool value, int index) { return value ? (1u << index) : 0u; }
+} // namespace
+
+std::optional<AsciiDelimiterRanges> AsciiDelimiterRanges::from_ascii_delimiters(const std::bitset<128> &is_delimiter) {
+  AsciiDelimiterRanges ranges;
+  ranges.m_is_delimiter = is_delimiter;
+  size_t c = 0;
+  while (c < is_delimiter.size()) {
+    if (!is_delimiter[c]) {
+      ++c;
+      continue;
+    }
+    auto begin = c;
+    while (c < is_delimiter.size() && is_delimiter[c])
+      ++c;
+    if (ranges.m_range_count == max_range_count)
+      return std::nullopt;
+    ranges.m_range_begins[ranges.m_range_count] = static_cast<char>(begin);
+    ranges.m_range_lengths[ranges.m_range_count] = static_cast<char>(c - begin);
+    ++ranges.m_range_count;
+  }
+  return ranges;
+}
+
+bool AsciiDelimiterRanges::classify_block_scalar(const wchar_t *block, AsciiBlockClasses &classes) const {
+  classes = {};
+  for (int i = 0; i < block_size; ++i) {
+    const auto c = block[i];
+    if (static_cast<uint32_t>(c) >= ascii_limit)
+      return false;
+    classes.delimiters |= bit_if(m_is_delimiter[c], i);
+    classes.upper |= bit_if(c >= L'A' && c <= L'Z', i);
+    classes.lower |= bit_if(c >= L'a' && c <= L'z', i);
+  }
+  return true;
+}
+
+#if defined(ASCII_SCAN_AVX2)
+
+bool AsciiDelimiterRanges::classify_block(const wchar_t *block, AsciiBlockClasses &classes) const {
+  if constexpr (!vectorization_possible)
+    return classify_block_scalar(block, classes);
+
+  const auto units = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+  const auto zero = _mm256_setzero_si256();
+  if (!_mm256_testz_si256(units, _mm256_set1_epi16(static_cast<short>(0xFF80))))
+    return false;
+
+  // unit is in [begin, begin + length) iff saturated (unit - begin) - (length - 1) is zero
+  auto in_range = [&](char begin, char length) {
+    const auto shifted = _mm256_sub_epi16(units, _mm256_set1_epi16(begin));
+    return _mm256_cmpeq_epi16(_mm256_subs_epu16(shifted, _mm256_set1_epi16(static_cast<short>(length - 1))), zero);
+  };
+  // packing works within 128-bit lanes, so quadwords are reordered afterwards to get one byte per unit in order
+  auto to_bits = [&](__m256i mask) {
+    const auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(mask, zero), 0xD8);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(packed)) & 0xFFFFu;
+  };
+
+  auto delimiters = zero;
+  for (size_t r = 0; r < m_range_count; ++r)
+    delimiters = _mm256_or_si256(delimiters, in_range(m_range_begins[r], m_range_lengths[r]));
+  classes.delimiters = to_bits(delimiters);
+  classes.upper = to_bits(in_range('A', 26));
+  classes.lower = to_bits(in_range('a', 26));
+  return true;
+}
+
+#elif defined(ASCII_SCAN_SSE2)
+
+bool AsciiDelimiterRanges::classify_block(const wchar_t *block, AsciiBlockClasses &classes) const {
+  if constexpr (!vectorization_possible)
+    return classify_block_scalar(block, classes);
+
+  const auto low_units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+  const auto high_units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 8));
+  const auto zero = _mm_setzero_si128();
+  const auto non_ascii_bits = _mm_and_si128(_mm_or_si128(low_units, high_units), _mm_set1_epi16(static_cast<short>(0xFF80)));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii_bits, zero)) != 0xFFFF)
+    return false;
+
+  // all units are ASCII so packing to bytes doesn't saturate anything
+  const auto bytes = _mm_packus_epi16(low_units, high_units);
+  // byte is in [begin, begin + length) iff saturated (byte - begin) - (length - 1) is zero
+  auto in_range = [&](char begin, char length) {
+    const auto shifted = _mm_sub_epi8(bytes, _mm_set1_epi8(begin));
+    return _mm_cmpeq_epi8(_mm_subs_epu8(shifted, _mm_set1_epi8(static_cast<char>(length - 1))), zero);
+  };
+  auto to_bits = [](__m128i mask) { return static_cast<uint32_t>(_mm_movemask_epi8(mask)); };
+
+  auto delimiters = zero;
+  for (size_t r = 0; r < m_range_count; ++r)
+    delimiters = _mm_or_si128(delimiters, in_range(m_range_begins[r], m_range_lengths[r]));
+  classes.delimiters = to_bits(delimiters);
+  classes.upper = to_bits(in_range('A', 26));
+  classes.lower = to_bits(in_range('a', 26));
+  return true;
+}
+
+#else
+
+bool AsciiDelimiterRanges::classify_block(const wchar_t *block, AsciiBlockClasses &classes) const {
+  return classify_block_scalar(block, classes);
+}
+
+#endif
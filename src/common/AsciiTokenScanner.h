@@ -0,0 +1,50 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
+
+// Character classes of `AsciiDelimiterRanges::block_size` consecutive code units as bit masks,
+// bit i corresponds to i-th code unit of the block
+struct AsciiBlockClasses {
+  uint32_t delimiters = 0;
+  uint32_t upper = 0;
+  uint32_t lower = 0;
+};
+
+// ASCII part of delimiter set stored as a few ranges, so whole block of text could be classified by vector comparisons.
+// Uses AVX2 if it's enabled for the build, SSE2 otherwise and plain loop if neither is available.
+class AsciiDelimiterRanges {
+public:
+  static constexpr int block_size = 16;
+  static constexpr size_t max_range_count = 16;
+
+  // Returns nullopt if ASCII delimiters are too scattered to be checked by ranges effectively
+  static std::optional<AsciiDelimiterRanges> from_ascii_delimiters(const std::bitset<128> &is_delimiter);
+  // Returns false if block contains non-ASCII code units, it should be classified by scalar code then
+  bool classify_block(const wchar_t *block, AsciiBlockClasses &classes) const;
+
+private:
+  bool classify_block_scalar(const wchar_t *block, AsciiBlockClasses &classes) const;
+
+private:
+  std::bitset<128> m_is_delimiter;
+  std::array<char, max_range_count> m_range_begins = {};
+  std::array<char, max_range_count> m_range_lengths = {};
+  size_t m_range_count = 0;
+};
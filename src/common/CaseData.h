@@ -0,0 +1,419 @@
+// Generated by generate_case_data.py from UnicodeData.txt and DerivedCoreProperties.txt of Unicode 14.0.0, do not edit
+#pragma once
+
+#include "CaseTables.h"
+
+namespace case_data {
+using enum CaseKind;
+
+// Distinct combinations of Uppercase/Lowercase properties and offsets to simple case mappings
+constexpr CaseRecord records[] = {
+  {none, 0, 0}, {upper, 0, 32}, {lower, -32, 0}, {lower, 0, 0},
+  {lower, 743, 0}, {lower, 121, 0}, {upper, 0, 1}, {lower, -1, 0},
+  {upper, 0, -199}, {lower, -232, 0}, {upper, 0, -121}, {lower, -300, 0},
+  {lower, 195, 0}, {upper, 0, 210}, {upper, 0, 206}, {upper, 0, 205},
+  {upper, 0, 79}, {upper, 0, 202}, {upper, 0, 203}, {upper, 0, 207},
+  {lower, 97, 0}, {upper, 0, 211}, {upper, 0, 209}, {lower, 163, 0},
+  {upper, 0, 213}, {lower, 130, 0}, {upper, 0, 214}, {upper, 0, 218},
+  {upper, 0, 217}, {upper, 0, 219}, {lower, 56, 0}, {upper, 0, 2},
+  {none, -1, 1}, {lower, -2, 0}, {lower, -79, 0}, {upper, 0, -97},
+  {upper, 0, -56}, {upper, 0, -130}, {upper, 0, 10795}, {upper, 0, -163},
+  {upper, 0, 10792}, {lower, 10815, 0}, {upper, 0, -195}, {upper, 0, 69},
+  {upper, 0, 71}, {lower, 10783, 0}, {lower, 10780, 0}, {lower, 10782, 0},
+  {lower, -210, 0}, {lower, -206, 0}, {lower, -205, 0}, {lower, -202, 0},
+  {lower, -203, 0}, {lower, 42319, 0}, {lower, 42315, 0}, {lower, -207, 0},
+  {lower, 42280, 0}, {lower, 42308, 0}, {lower, -209, 0}, {lower, -211, 0},
+  {lower, 10743, 0}, {lower, 42305, 0}, {lower, 10749, 0}, {lower, -213, 0},
+  {lower, -214, 0}, {lower, 10727, 0}, {lower, -218, 0}, {lower, 42307, 0},
+  {lower, 42282, 0}, {lower, -69, 0}, {lower, -217, 0}, {lower, -71, 0},
+  {lower, -219, 0}, {lower, 42261, 0}, {lower, 42258, 0}, {lower, 84, 0},
+  {upper, 0, 116}, {upper, 0, 38}, {upper, 0, 37}, {upper, 0, 64},
+  {upper, 0, 63}, {lower, -38, 0}, {lower, -37, 0}, {lower, -31, 0},
+  {lower, -64, 0}, {lower, -63, 0}, {upper, 0, 8}, {lower, -62, 0},
+  {lower, -57, 0}, {upper, 0, 0}, {lower, -47, 0}, {lower, -54, 0},
+  {lower, -8, 0}, {lower, -86, 0}, {lower, -80, 0}, {lower, 7, 0},
+  {lower, -116, 0}, {upper, 0, -60}, {lower, -96, 0}, {upper, 0, -7},
+  {upper, 0, 80}, {upper, 0, 15}, {lower, -15, 0}, {upper, 0, 48},
+  {lower, -48, 0}, {upper, 0, 7264}, {lower, 3008, 0}, {upper, 0, 38864},
+  {lower, -6254, 0}, {lower, -6253, 0}, {lower, -6244, 0}, {lower, -6242, 0},
+  {lower, -6243, 0}, {lower, -6236, 0}, {lower, -6181, 0}, {lower, 35266, 0},
+  {upper, 0, -3008}, {lower, 35332, 0}, {lower, 3814, 0}, {lower, 35384, 0},
+  {lower, -59, 0}, {upper, 0, -7615}, {lower, 8, 0}, {upper, 0, -8},
+  {lower, 74, 0}, {lower, 86, 0}, {lower, 100, 0}, {lower, 128, 0},
+  {lower, 112, 0}, {lower, 126, 0}, {none, 0, -8}, {lower, 9, 0},
+  {upper, 0, -74}, {none, 0, -9}, {lower, -7205, 0}, {upper, 0, -86},
+  {upper, 0, -100}, {upper, 0, -112}, {upper, 0, -128}, {upper, 0, -126},
+  {upper, 0, -7517}, {upper, 0, -8383}, {upper, 0, -8262}, {upper, 0, 28},
+  {lower, -28, 0}, {upper, 0, 16}, {lower, -16, 0}, {upper, 0, 26},
+  {lower, -26, 0}, {upper, 0, -10743}, {upper, 0, -3814}, {upper, 0, -10727},
+  {lower, -10795, 0}, {lower, -10792, 0}, {upper, 0, -10780}, {upper, 0, -10749},
+  {upper, 0, -10783}, {upper, 0, -10782}, {upper, 0, -10815}, {lower, -7264, 0},
+  {upper, 0, -35332}, {upper, 0, -42280}, {lower, 48, 0}, {upper, 0, -42308},
+  {upper, 0, -42319}, {upper, 0, -42315}, {upper, 0, -42305}, {upper, 0, -42258},
+  {upper, 0, -42282}, {upper, 0, -42261}, {upper, 0, 928}, {upper, 0, -48},
+  {upper, 0, -42307}, {upper, 0, -35384}, {lower, -928, 0}, {lower, -38864, 0},
+};
+
+// Sorted non-overlapping ranges of BMP code points sharing a record, ones absent here use records[0]
+constexpr CaseRange ranges[] = {
+  {0x0041, 0x005A, 1}, {0x0061, 0x007A, 2}, {0x00AA, 0x00AA, 3}, {0x00B5, 0x00B5, 4},
+  {0x00BA, 0x00BA, 3}, {0x00C0, 0x00D6, 1}, {0x00D8, 0x00DE, 1}, {0x00DF, 0x00DF, 3},
+  {0x00E0, 0x00F6, 2}, {0x00F8, 0x00FE, 2}, {0x00FF, 0x00FF, 5}, {0x0100, 0x0100, 6},
+  {0x0101, 0x0101, 7}, {0x0102, 0x0102, 6}, {0x0103, 0x0103, 7}, {0x0104, 0x0104, 6},
+  {0x0105, 0x0105, 7}, {0x0106, 0x0106, 6}, {0x0107, 0x0107, 7}, {0x0108, 0x0108, 6},
+  {0x0109, 0x0109, 7}, {0x010A, 0x010A, 6}, {0x010B, 0x010B, 7}, {0x010C, 0x010C, 6},
+  {0x010D, 0x010D, 7}, {0x010E, 0x010E, 6}, {0x010F, 0x010F, 7}, {0x0110, 0x0110, 6},
+  {0x0111, 0x0111, 7}, {0x0112, 0x0112, 6}, {0x0113, 0x0113, 7}, {0x0114, 0x0114, 6},
+  {0x0115, 0x0115, 7}, {0x0116, 0x0116, 6}, {0x0117, 0x0117, 7}, {0x0118, 0x0118, 6},
+  {0x0119, 0x0119, 7}, {0x011A, 0x011A, 6}, {0x011B, 0x011B, 7}, {0x011C, 0x011C, 6},
+  {0x011D, 0x011D, 7}, {0x011E, 0x011E, 6}, {0x011F, 0x011F, 7}, {0x0120, 0x0120, 6},
+  {0x0121, 0x0121, 7}, {0x0122, 0x0122, 6}, {0x0123, 0x0123, 7}, {0x0124, 0x0124, 6},
+  {0x0125, 0x0125, 7}, {0x0126, 0x0126, 6}, {0x0127, 0x0127, 7}, {0x0128, 0x0128, 6},
+  {0x0129, 0x0129, 7}, {0x012A, 0x012A, 6}, {0x012B, 0x012B, 7}, {0x012C, 0x012C, 6},
+  {0x012D, 0x012D, 7}, {0x012E, 0x012E, 6}, {0x012F, 0x012F, 7}, {0x0130, 0x0130, 8},
+  {0x0131, 0x0131, 9}, {0x0132, 0x0132, 6}, {0x0133, 0x0133, 7}, {0x0134, 0x0134, 6},
+  {0x0135, 0x0135, 7}, {0x0136, 0x0136, 6}, {0x0137, 0x0137, 7}, {0x0138, 0x0138, 3},
+  {0x0139, 0x0139, 6}, {0x013A, 0x013A, 7}, {0x013B, 0x013B, 6}, {0x013C, 0x013C, 7},
+  {0x013D, 0x013D, 6}, {0x013E, 0x013E, 7}, {0x013F, 0x013F, 6}, {0x0140, 0x0140, 7},
+  {0x0141, 0x0141, 6}, {0x0142, 0x0142, 7}, {0x0143, 0x0143, 6}, {0x0144, 0x0144, 7},
+  {0x0145, 0x0145, 6}, {0x0146, 0x0146, 7}, {0x0147, 0x0147, 6}, {0x0148, 0x0148, 7},
+  {0x0149, 0x0149, 3}, {0x014A, 0x014A, 6}, {0x014B, 0x014B, 7}, {0x014C, 0x014C, 6},
+  {0x014D, 0x014D, 7}, {0x014E, 0x014E, 6}, {0x014F, 0x014F, 7}, {0x0150, 0x0150, 6},
+  {0x0151, 0x0151, 7}, {0x0152, 0x0152, 6}, {0x0153, 0x0153, 7}, {0x0154, 0x0154, 6},
+  {0x0155, 0x0155, 7}, {0x0156, 0x0156, 6}, {0x0157, 0x0157, 7}, {0x0158, 0x0158, 6},
+  {0x0159, 0x0159, 7}, {0x015A, 0x015A, 6}, {0x015B, 0x015B, 7}, {0x015C, 0x015C, 6},
+  {0x015D, 0x015D, 7}, {0x015E, 0x015E, 6}, {0x015F, 0x015F, 7}, {0x0160, 0x0160, 6},
+  {0x0161, 0x0161, 7}, {0x0162, 0x0162, 6}, {0x0163, 0x0163, 7}, {0x0164, 0x0164, 6},
+  {0x0165, 0x0165, 7}, {0x0166, 0x0166, 6}, {0x0167, 0x0167, 7}, {0x0168, 0x0168, 6},
+  {0x0169, 0x0169, 7}, {0x016A, 0x016A, 6}, {0x016B, 0x016B, 7}, {0x016C, 0x016C, 6},
+  {0x016D, 0x016D, 7}, {0x016E, 0x016E, 6}, {0x016F, 0x016F, 7}, {0x0170, 0x0170, 6},
+  {0x0171, 0x0171, 7}, {0x0172, 0x0172, 6}, {0x0173, 0x0173, 7}, {0x0174, 0x0174, 6},
+  {0x0175, 0x0175, 7}, {0x0176, 0x0176, 6}, {0x0177, 0x0177, 7}, {0x0178, 0x0178, 10},
+  {0x0179, 0x0179, 6}, {0x017A, 0x017A, 7}, {0x017B, 0x017B, 6}, {0x017C, 0x017C, 7},
+  {0x017D, 0x017D, 6}, {0x017E, 0x017E, 7}, {0x017F, 0x017F, 11}, {0x0180, 0x0180, 12},
+  {0x0181, 0x0181, 13}, {0x0182, 0x0182, 6}, {0x0183, 0x0183, 7}, {0x0184, 0x0184, 6},
+  {0x0185, 0x0185, 7}, {0x0186, 0x0186, 14}, {0x0187, 0x0187, 6}, {0x0188, 0x0188, 7},
+  {0x0189, 0x018A, 15}, {0x018B, 0x018B, 6}, {0x018C, 0x018C, 7}, {0x018D, 0x018D, 3},
+  {0x018E, 0x018E, 16}, {0x018F, 0x018F, 17}, {0x0190, 0x0190, 18}, {0x0191, 0x0191, 6},
+  {0x0192, 0x0192, 7}, {0x0193, 0x0193, 15}, {0x0194, 0x0194, 19}, {0x0195, 0x0195, 20},
+  {0x0196, 0x0196, 21}, {0x0197, 0x0197, 22}, {0x0198, 0x0198, 6}, {0x0199, 0x0199, 7},
+  {0x019A, 0x019A, 23}, {0x019B, 0x019B, 3}, {0x019C, 0x019C, 21}, {0x019D, 0x019D, 24},
+  {0x019E, 0x019E, 25}, {0x019F, 0x019F, 26}, {0x01A0, 0x01A0, 6}, {0x01A1, 0x01A1, 7},
+  {0x01A2, 0x01A2, 6}, {0x01A3, 0x01A3, 7}, {0x01A4, 0x01A4, 6}, {0x01A5, 0x01A5, 7},
+  {0x01A6, 0x01A6, 27}, {0x01A7, 0x01A7, 6}, {0x01A8, 0x01A8, 7}, {0x01A9, 0x01A9, 27},
+  {0x01AA, 0x01AB, 3}, {0x01AC, 0x01AC, 6}, {0x01AD, 0x01AD, 7}, {0x01AE, 0x01AE, 27},
+  {0x01AF, 0x01AF, 6}, {0x01B0, 0x01B0, 7}, {0x01B1, 0x01B2, 28}, {0x01B3, 0x01B3, 6},
+  {0x01B4, 0x01B4, 7}, {0x01B5, 0x01B5, 6}, {0x01B6, 0x01B6, 7}, {0x01B7, 0x01B7, 29},
+  {0x01B8, 0x01B8, 6}, {0x01B9, 0x01B9, 7}, {0x01BA, 0x01BA, 3}, {0x01BC, 0x01BC, 6},
+  {0x01BD, 0x01BD, 7}, {0x01BE, 0x01BE, 3}, {0x01BF, 0x01BF, 30}, {0x01C4, 0x01C4, 31},
+  {0x01C5, 0x01C5, 32}, {0x01C6, 0x01C6, 33}, {0x01C7, 0x01C7, 31}, {0x01C8, 0x01C8, 32},
+  {0x01C9, 0x01C9, 33}, {0x01CA, 0x01CA, 31}, {0x01CB, 0x01CB, 32}, {0x01CC, 0x01CC, 33},
+  {0x01CD, 0x01CD, 6}, {0x01CE, 0x01CE, 7}, {0x01CF, 0x01CF, 6}, {0x01D0, 0x01D0, 7},
+  {0x01D1, 0x01D1, 6}, {0x01D2, 0x01D2, 7}, {0x01D3, 0x01D3, 6}, {0x01D4, 0x01D4, 7},
+  {0x01D5, 0x01D5, 6}, {0x01D6, 0x01D6, 7}, {0x01D7, 0x01D7, 6}, {0x01D8, 0x01D8, 7},
+  {0x01D9, 0x01D9, 6}, {0x01DA, 0x01DA, 7}, {0x01DB, 0x01DB, 6}, {0x01DC, 0x01DC, 7},
+  {0x01DD, 0x01DD, 34}, {0x01DE, 0x01DE, 6}, {0x01DF, 0x01DF, 7}, {0x01E0, 0x01E0, 6},
+  {0x01E1, 0x01E1, 7}, {0x01E2, 0x01E2, 6}, {0x01E3, 0x01E3, 7}, {0x01E4, 0x01E4, 6},
+  {0x01E5, 0x01E5, 7}, {0x01E6, 0x01E6, 6}, {0x01E7, 0x01E7, 7}, {0x01E8, 0x01E8, 6},
+  {0x01E9, 0x01E9, 7}, {0x01EA, 0x01EA, 6}, {0x01EB, 0x01EB, 7}, {0x01EC, 0x01EC, 6},
+  {0x01ED, 0x01ED, 7}, {0x01EE, 0x01EE, 6}, {0x01EF, 0x01EF, 7}, {0x01F0, 0x01F0, 3},
+  {0x01F1, 0x01F1, 31}, {0x01F2, 0x01F2, 32}, {0x01F3, 0x01F3, 33}, {0x01F4, 0x01F4, 6},
+  {0x01F5, 0x01F5, 7}, {0x01F6, 0x01F6, 35}, {0x01F7, 0x01F7, 36}, {0x01F8, 0x01F8, 6},
+  {0x01F9, 0x01F9, 7}, {0x01FA, 0x01FA, 6}, {0x01FB, 0x01FB, 7}, {0x01FC, 0x01FC, 6},
+  {0x01FD, 0x01FD, 7}, {0x01FE, 0x01FE, 6}, {0x01FF, 0x01FF, 7}, {0x0200, 0x0200, 6},
+  {0x0201, 0x0201, 7}, {0x0202, 0x0202, 6}, {0x0203, 0x0203, 7}, {0x0204, 0x0204, 6},
+  {0x0205, 0x0205, 7}, {0x0206, 0x0206, 6}, {0x0207, 0x0207, 7}, {0x0208, 0x0208, 6},
+  {0x0209, 0x0209, 7}, {0x020A, 0x020A, 6}, {0x020B, 0x020B, 7}, {0x020C, 0x020C, 6},
+  {0x020D, 0x020D, 7}, {0x020E, 0x020E, 6}, {0x020F, 0x020F, 7}, {0x0210, 0x0210, 6},
+  {0x0211, 0x0211, 7}, {0x0212, 0x0212, 6}, {0x0213, 0x0213, 7}, {0x0214, 0x0214, 6},
+  {0x0215, 0x0215, 7}, {0x0216, 0x0216, 6}, {0x0217, 0x0217, 7}, {0x0218, 0x0218, 6},
+  {0x0219, 0x0219, 7}, {0x021A, 0x021A, 6}, {0x021B, 0x021B, 7}, {0x021C, 0x021C, 6},
+  {0x021D, 0x021D, 7}, {0x021E, 0x021E, 6}, {0x021F, 0x021F, 7}, {0x0220, 0x0220, 37},
+  {0x0221, 0x0221, 3}, {0x0222, 0x0222, 6}, {0x0223, 0x0223, 7}, {0x0224, 0x0224, 6},
+  {0x0225, 0x0225, 7}, {0x0226, 0x0226, 6}, {0x0227, 0x0227, 7}, {0x0228, 0x0228, 6},
+  {0x0229, 0x0229, 7}, {0x022A, 0x022A, 6}, {0x022B, 0x022B, 7}, {0x022C, 0x022C, 6},
+  {0x022D, 0x022D, 7}, {0x022E, 0x022E, 6}, {0x022F, 0x022F, 7}, {0x0230, 0x0230, 6},
+  {0x0231, 0x0231, 7}, {0x0232, 0x0232, 6}, {0x0233, 0x0233, 7}, {0x0234, 0x0239, 3},
+  {0x023A, 0x023A, 38}, {0x023B, 0x023B, 6}, {0x023C, 0x023C, 7}, {0x023D, 0x023D, 39},
+  {0x023E, 0x023E, 40}, {0x023F, 0x0240, 41}, {0x0241, 0x0241, 6}, {0x0242, 0x0242, 7},
+  {0x0243, 0x0243, 42}, {0x0244, 0x0244, 43}, {0x0245, 0x0245, 44}, {0x0246, 0x0246, 6},
+  {0x0247, 0x0247, 7}, {0x0248, 0x0248, 6}, {0x0249, 0x0249, 7}, {0x024A, 0x024A, 6},
+  {0x024B, 0x024B, 7}, {0x024C, 0x024C, 6}, {0x024D, 0x024D, 7}, {0x024E, 0x024E, 6},
+  {0x024F, 0x024F, 7}, {0x0250, 0x0250, 45}, {0x0251, 0x0251, 46}, {0x0252, 0x0252, 47},
+  {0x0253, 0x0253, 48}, {0x0254, 0x0254, 49}, {0x0255, 0x0255, 3}, {0x0256, 0x0257, 50},
+  {0x0258, 0x0258, 3}, {0x0259, 0x0259, 51}, {0x025A, 0x025A, 3}, {0x025B, 0x025B, 52},
+  {0x025C, 0x025C, 53}, {0x025D, 0x025F, 3}, {0x0260, 0x0260, 50}, {0x0261, 0x0261, 54},
+  {0x0262, 0x0262, 3}, {0x0263, 0x0263, 55}, {0x0264, 0x0264, 3}, {0x0265, 0x0265, 56},
+  {0x0266, 0x0266, 57}, {0x0267, 0x0267, 3}, {0x0268, 0x0268, 58}, {0x0269, 0x0269, 59},
+  {0x026A, 0x026A, 57}, {0x026B, 0x026B, 60}, {0x026C, 0x026C, 61}, {0x026D, 0x026E, 3},
+  {0x026F, 0x026F, 59}, {0x0270, 0x0270, 3}, {0x0271, 0x0271, 62}, {0x0272, 0x0272, 63},
+  {0x0273, 0x0274, 3}, {0x0275, 0x0275, 64}, {0x0276, 0x027C, 3}, {0x027D, 0x027D, 65},
+  {0x027E, 0x027F, 3}, {0x0280, 0x0280, 66}, {0x0281, 0x0281, 3}, {0x0282, 0x0282, 67},
+  {0x0283, 0x0283, 66}, {0x0284, 0x0286, 3}, {0x0287, 0x0287, 68}, {0x0288, 0x0288, 66},
+  {0x0289, 0x0289, 69}, {0x028A, 0x028B, 70}, {0x028C, 0x028C, 71}, {0x028D, 0x0291, 3},
+  {0x0292, 0x0292, 72}, {0x0293, 0x0293, 3}, {0x0295, 0x029C, 3}, {0x029D, 0x029D, 73},
+  {0x029E, 0x029E, 74}, {0x029F, 0x02B8, 3}, {0x02C0, 0x02C1, 3}, {0x02E0, 0x02E4, 3},
+  {0x0345, 0x0345, 75}, {0x0370, 0x0370, 6}, {0x0371, 0x0371, 7}, {0x0372, 0x0372, 6},
+  {0x0373, 0x0373, 7}, {0x0376, 0x0376, 6}, {0x0377, 0x0377, 7}, {0x037A, 0x037A, 3},
+  {0x037B, 0x037D, 25}, {0x037F, 0x037F, 76}, {0x0386, 0x0386, 77}, {0x0388, 0x038A, 78},
+  {0x038C, 0x038C, 79}, {0x038E, 0x038F, 80}, {0x0390, 0x0390, 3}, {0x0391, 0x03A1, 1},
+  {0x03A3, 0x03AB, 1}, {0x03AC, 0x03AC, 81}, {0x03AD, 0x03AF, 82}, {0x03B0, 0x03B0, 3},
+  {0x03B1, 0x03C1, 2}, {0x03C2, 0x03C2, 83}, {0x03C3, 0x03CB, 2}, {0x03CC, 0x03CC, 84},
+  {0x03CD, 0x03CE, 85}, {0x03CF, 0x03CF, 86}, {0x03D0, 0x03D0, 87}, {0x03D1, 0x03D1, 88},
+  {0x03D2, 0x03D4, 89}, {0x03D5, 0x03D5, 90}, {0x03D6, 0x03D6, 91}, {0x03D7, 0x03D7, 92},
+  {0x03D8, 0x03D8, 6}, {0x03D9, 0x03D9, 7}, {0x03DA, 0x03DA, 6}, {0x03DB, 0x03DB, 7},
+  {0x03DC, 0x03DC, 6}, {0x03DD, 0x03DD, 7}, {0x03DE, 0x03DE, 6}, {0x03DF, 0x03DF, 7},
+  {0x03E0, 0x03E0, 6}, {0x03E1, 0x03E1, 7}, {0x03E2, 0x03E2, 6}, {0x03E3, 0x03E3, 7},
+  {0x03E4, 0x03E4, 6}, {0x03E5, 0x03E5, 7}, {0x03E6, 0x03E6, 6}, {0x03E7, 0x03E7, 7},
+  {0x03E8, 0x03E8, 6}, {0x03E9, 0x03E9, 7}, {0x03EA, 0x03EA, 6}, {0x03EB, 0x03EB, 7},
+  {0x03EC, 0x03EC, 6}, {0x03ED, 0x03ED, 7}, {0x03EE, 0x03EE, 6}, {0x03EF, 0x03EF, 7},
+  {0x03F0, 0x03F0, 93}, {0x03F1, 0x03F1, 94}, {0x03F2, 0x03F2, 95}, {0x03F3, 0x03F3, 96},
+  {0x03F4, 0x03F4, 97}, {0x03F5, 0x03F5, 98}, {0x03F7, 0x03F7, 6}, {0x03F8, 0x03F8, 7},
+  {0x03F9, 0x03F9, 99}, {0x03FA, 0x03FA, 6}, {0x03FB, 0x03FB, 7}, {0x03FC, 0x03FC, 3},
+  {0x03FD, 0x03FF, 37}, {0x0400, 0x040F, 100}, {0x0410, 0x042F, 1}, {0x0430, 0x044F, 2},
+  {0x0450, 0x045F, 94}, {0x0460, 0x0460, 6}, {0x0461, 0x0461, 7}, {0x0462, 0x0462, 6},
+  {0x0463, 0x0463, 7}, {0x0464, 0x0464, 6}, {0x0465, 0x0465, 7}, {0x0466, 0x0466, 6},
+  {0x0467, 0x0467, 7}, {0x0468, 0x0468, 6}, {0x0469, 0x0469, 7}, {0x046A, 0x046A, 6},
+  {0x046B, 0x046B, 7}, {0x046C, 0x046C, 6}, {0x046D, 0x046D, 7}, {0x046E, 0x046E, 6},
+  {0x046F, 0x046F, 7}, {0x0470, 0x0470, 6}, {0x0471, 0x0471, 7}, {0x0472, 0x0472, 6},
+  {0x0473, 0x0473, 7}, {0x0474, 0x0474, 6}, {0x0475, 0x0475, 7}, {0x0476, 0x0476, 6},
+  {0x0477, 0x0477, 7}, {0x0478, 0x0478, 6}, {0x0479, 0x0479, 7}, {0x047A, 0x047A, 6},
+  {0x047B, 0x047B, 7}, {0x047C, 0x047C, 6}, {0x047D, 0x047D, 7}, {0x047E, 0x047E, 6},
+  {0x047F, 0x047F, 7}, {0x0480, 0x0480, 6}, {0x0481, 0x0481, 7}, {0x048A, 0x048A, 6},
+  {0x048B, 0x048B, 7}, {0x048C, 0x048C, 6}, {0x048D, 0x048D, 7}, {0x048E, 0x048E, 6},
+  {0x048F, 0x048F, 7}, {0x0490, 0x0490, 6}, {0x0491, 0x0491, 7}, {0x0492, 0x0492, 6},
+  {0x0493, 0x0493, 7}, {0x0494, 0x0494, 6}, {0x0495, 0x0495, 7}, {0x0496, 0x0496, 6},
+  {0x0497, 0x0497, 7}, {0x0498, 0x0498, 6}, {0x0499, 0x0499, 7}, {0x049A, 0x049A, 6},
+  {0x049B, 0x049B, 7}, {0x049C, 0x049C, 6}, {0x049D, 0x049D, 7}, {0x049E, 0x049E, 6},
+  {0x049F, 0x049F, 7}, {0x04A0, 0x04A0, 6}, {0x04A1, 0x04A1, 7}, {0x04A2, 0x04A2, 6},
+  {0x04A3, 0x04A3, 7}, {0x04A4, 0x04A4, 6}, {0x04A5, 0x04A5, 7}, {0x04A6, 0x04A6, 6},
+  {0x04A7, 0x04A7, 7}, {0x04A8, 0x04A8, 6}, {0x04A9, 0x04A9, 7}, {0x04AA, 0x04AA, 6},
+  {0x04AB, 0x04AB, 7}, {0x04AC, 0x04AC, 6}, {0x04AD, 0x04AD, 7}, {0x04AE, 0x04AE, 6},
+  {0x04AF, 0x04AF, 7}, {0x04B0, 0x04B0, 6}, {0x04B1, 0x04B1, 7}, {0x04B2, 0x04B2, 6},
+  {0x04B3, 0x04B3, 7}, {0x04B4, 0x04B4, 6}, {0x04B5, 0x04B5, 7}, {0x04B6, 0x04B6, 6},
+  {0x04B7, 0x04B7, 7}, {0x04B8, 0x04B8, 6}, {0x04B9, 0x04B9, 7}, {0x04BA, 0x04BA, 6},
+  {0x04BB, 0x04BB, 7}, {0x04BC, 0x04BC, 6}, {0x04BD, 0x04BD, 7}, {0x04BE, 0x04BE, 6},
+  {0x04BF, 0x04BF, 7}, {0x04C0, 0x04C0, 101}, {0x04C1, 0x04C1, 6}, {0x04C2, 0x04C2, 7},
+  {0x04C3, 0x04C3, 6}, {0x04C4, 0x04C4, 7}, {0x04C5, 0x04C5, 6}, {0x04C6, 0x04C6, 7},
+  {0x04C7, 0x04C7, 6}, {0x04C8, 0x04C8, 7}, {0x04C9, 0x04C9, 6}, {0x04CA, 0x04CA, 7},
+  {0x04CB, 0x04CB, 6}, {0x04CC, 0x04CC, 7}, {0x04CD, 0x04CD, 6}, {0x04CE, 0x04CE, 7},
+  {0x04CF, 0x04CF, 102}, {0x04D0, 0x04D0, 6}, {0x04D1, 0x04D1, 7}, {0x04D2, 0x04D2, 6},
+  {0x04D3, 0x04D3, 7}, {0x04D4, 0x04D4, 6}, {0x04D5, 0x04D5, 7}, {0x04D6, 0x04D6, 6},
+  {0x04D7, 0x04D7, 7}, {0x04D8, 0x04D8, 6}, {0x04D9, 0x04D9, 7}, {0x04DA, 0x04DA, 6},
+  {0x04DB, 0x04DB, 7}, {0x04DC, 0x04DC, 6}, {0x04DD, 0x04DD, 7}, {0x04DE, 0x04DE, 6},
+  {0x04DF, 0x04DF, 7}, {0x04E0, 0x04E0, 6}, {0x04E1, 0x04E1, 7}, {0x04E2, 0x04E2, 6},
+  {0x04E3, 0x04E3, 7}, {0x04E4, 0x04E4, 6}, {0x04E5, 0x04E5, 7}, {0x04E6, 0x04E6, 6},
+  {0x04E7, 0x04E7, 7}, {0x04E8, 0x04E8, 6}, {0x04E9, 0x04E9, 7}, {0x04EA, 0x04EA, 6},
+  {0x04EB, 0x04EB, 7}, {0x04EC, 0x04EC, 6}, {0x04ED, 0x04ED, 7}, {0x04EE, 0x04EE, 6},
+  {0x04EF, 0x04EF, 7}, {0x04F0, 0x04F0, 6}, {0x04F1, 0x04F1, 7}, {0x04F2, 0x04F2, 6},
+  {0x04F3, 0x04F3, 7}, {0x04F4, 0x04F4, 6}, {0x04F5, 0x04F5, 7}, {0x04F6, 0x04F6, 6},
+  {0x04F7, 0x04F7, 7}, {0x04F8, 0x04F8, 6}, {0x04F9, 0x04F9, 7}, {0x04FA, 0x04FA, 6},
+  {0x04FB, 0x04FB, 7}, {0x04FC, 0x04FC, 6}, {0x04FD, 0x04FD, 7}, {0x04FE, 0x04FE, 6},
+  {0x04FF, 0x04FF, 7}, {0x0500, 0x0500, 6}, {0x0501, 0x0501, 7}, {0x0502, 0x0502, 6},
+  {0x0503, 0x0503, 7}, {0x0504, 0x0504, 6}, {0x0505, 0x0505, 7}, {0x0506, 0x0506, 6},
+  {0x0507, 0x0507, 7}, {0x0508, 0x0508, 6}, {0x0509, 0x0509, 7}, {0x050A, 0x050A, 6},
+  {0x050B, 0x050B, 7}, {0x050C, 0x050C, 6}, {0x050D, 0x050D, 7}, {0x050E, 0x050E, 6},
+  {0x050F, 0x050F, 7}, {0x0510, 0x0510, 6}, {0x0511, 0x0511, 7}, {0x0512, 0x0512, 6},
+  {0x0513, 0x0513, 7}, {0x0514, 0x0514, 6}, {0x0515, 0x0515, 7}, {0x0516, 0x0516, 6},
+  {0x0517, 0x0517, 7}, {0x0518, 0x0518, 6}, {0x0519, 0x0519, 7}, {0x051A, 0x051A, 6},
+  {0x051B, 0x051B, 7}, {0x051C, 0x051C, 6}, {0x051D, 0x051D, 7}, {0x051E, 0x051E, 6},
+  {0x051F, 0x051F, 7}, {0x0520, 0x0520, 6}, {0x0521, 0x0521, 7}, {0x0522, 0x0522, 6},
+  {0x0523, 0x0523, 7}, {0x0524, 0x0524, 6}, {0x0525, 0x0525, 7}, {0x0526, 0x0526, 6},
+  {0x0527, 0x0527, 7}, {0x0528, 0x0528, 6}, {0x0529, 0x0529, 7}, {0x052A, 0x052A, 6},
+  {0x052B, 0x052B, 7}, {0x052C, 0x052C, 6}, {0x052D, 0x052D, 7}, {0x052E, 0x052E, 6},
+  {0x052F, 0x052F, 7}, {0x0531, 0x0556, 103}, {0x0560, 0x0560, 3}, {0x0561, 0x0586, 104},
+  {0x0587, 0x0588, 3}, {0x10A0, 0x10C5, 105}, {0x10C7, 0x10C7, 105}, {0x10CD, 0x10CD, 105},
+  {0x10D0, 0x10FA, 106}, {0x10FD, 0x10FF, 106}, {0x13A0, 0x13EF, 107}, {0x13F0, 0x13F5, 86},
+  {0x13F8, 0x13FD, 92}, {0x1C80, 0x1C80, 108}, {0x1C81, 0x1C81, 109}, {0x1C82, 0x1C82, 110},
+  {0x1C83, 0x1C84, 111}, {0x1C85, 0x1C85, 112}, {0x1C86, 0x1C86, 113}, {0x1C87, 0x1C87, 114},
+  {0x1C88, 0x1C88, 115}, {0x1C90, 0x1CBA, 116}, {0x1CBD, 0x1CBF, 116}, {0x1D00, 0x1D78, 3},
+  {0x1D79, 0x1D79, 117}, {0x1D7A, 0x1D7C, 3}, {0x1D7D, 0x1D7D, 118}, {0x1D7E, 0x1D8D, 3},
+  {0x1D8E, 0x1D8E, 119}, {0x1D8F, 0x1DBF, 3}, {0x1E00, 0x1E00, 6}, {0x1E01, 0x1E01, 7},
+  {0x1E02, 0x1E02, 6}, {0x1E03, 0x1E03, 7}, {0x1E04, 0x1E04, 6}, {0x1E05, 0x1E05, 7},
+  {0x1E06, 0x1E06, 6}, {0x1E07, 0x1E07, 7}, {0x1E08, 0x1E08, 6}, {0x1E09, 0x1E09, 7},
+  {0x1E0A, 0x1E0A, 6}, {0x1E0B, 0x1E0B, 7}, {0x1E0C, 0x1E0C, 6}, {0x1E0D, 0x1E0D, 7},
+  {0x1E0E, 0x1E0E, 6}, {0x1E0F, 0x1E0F, 7}, {0x1E10, 0x1E10, 6}, {0x1E11, 0x1E11, 7},
+  {0x1E12, 0x1E12, 6}, {0x1E13, 0x1E13, 7}, {0x1E14, 0x1E14, 6}, {0x1E15, 0x1E15, 7},
+  {0x1E16, 0x1E16, 6}, {0x1E17, 0x1E17, 7}, {0x1E18, 0x1E18, 6}, {0x1E19, 0x1E19, 7},
+  {0x1E1A, 0x1E1A, 6}, {0x1E1B, 0x1E1B, 7}, {0x1E1C, 0x1E1C, 6}, {0x1E1D, 0x1E1D, 7},
+  {0x1E1E, 0x1E1E, 6}, {0x1E1F, 0x1E1F, 7}, {0x1E20, 0x1E20, 6}, {0x1E21, 0x1E21, 7},
+  {0x1E22, 0x1E22, 6}, {0x1E23, 0x1E23, 7}, {0x1E24, 0x1E24, 6}, {0x1E25, 0x1E25, 7},
+  {0x1E26, 0x1E26, 6}, {0x1E27, 0x1E27, 7}, {0x1E28, 0x1E28, 6}, {0x1E29, 0x1E29, 7},
+  {0x1E2A, 0x1E2A, 6}, {0x1E2B, 0x1E2B, 7}, {0x1E2C, 0x1E2C, 6}, {0x1E2D, 0x1E2D, 7},
+  {0x1E2E, 0x1E2E, 6}, {0x1E2F, 0x1E2F, 7}, {0x1E30, 0x1E30, 6}, {0x1E31, 0x1E31, 7},
+  {0x1E32, 0x1E32, 6}, {0x1E33, 0x1E33, 7}, {0x1E34, 0x1E34, 6}, {0x1E35, 0x1E35, 7},
+  {0x1E36, 0x1E36, 6}, {0x1E37, 0x1E37, 7}, {0x1E38, 0x1E38, 6}, {0x1E39, 0x1E39, 7},
+  {0x1E3A, 0x1E3A, 6}, {0x1E3B, 0x1E3B, 7}, {0x1E3C, 0x1E3C, 6}, {0x1E3D, 0x1E3D, 7},
+  {0x1E3E, 0x1E3E, 6}, {0x1E3F, 0x1E3F, 7}, {0x1E40, 0x1E40, 6}, {0x1E41, 0x1E41, 7},
+  {0x1E42, 0x1E42, 6}, {0x1E43, 0x1E43, 7}, {0x1E44, 0x1E44, 6}, {0x1E45, 0x1E45, 7},
+  {0x1E46, 0x1E46, 6}, {0x1E47, 0x1E47, 7}, {0x1E48, 0x1E48, 6}, {0x1E49, 0x1E49, 7},
+  {0x1E4A, 0x1E4A, 6}, {0x1E4B, 0x1E4B, 7}, {0x1E4C, 0x1E4C, 6}, {0x1E4D, 0x1E4D, 7},
+  {0x1E4E, 0x1E4E, 6}, {0x1E4F, 0x1E4F, 7}, {0x1E50, 0x1E50, 6}, {0x1E51, 0x1E51, 7},
+  {0x1E52, 0x1E52, 6}, {0x1E53, 0x1E53, 7}, {0x1E54, 0x1E54, 6}, {0x1E55, 0x1E55, 7},
+  {0x1E56, 0x1E56, 6}, {0x1E57, 0x1E57, 7}, {0x1E58, 0x1E58, 6}, {0x1E59, 0x1E59, 7},
+  {0x1E5A, 0x1E5A, 6}, {0x1E5B, 0x1E5B, 7}, {0x1E5C, 0x1E5C, 6}, {0x1E5D, 0x1E5D, 7},
+  {0x1E5E, 0x1E5E, 6}, {0x1E5F, 0x1E5F, 7}, {0x1E60, 0x1E60, 6}, {0x1E61, 0x1E61, 7},
+  {0x1E62, 0x1E62, 6}, {0x1E63, 0x1E63, 7}, {0x1E64, 0x1E64, 6}, {0x1E65, 0x1E65, 7},
+  {0x1E66, 0x1E66, 6}, {0x1E67, 0x1E67, 7}, {0x1E68, 0x1E68, 6}, {0x1E69, 0x1E69, 7},
+  {0x1E6A, 0x1E6A, 6}, {0x1E6B, 0x1E6B, 7}, {0x1E6C, 0x1E6C, 6}, {0x1E6D, 0x1E6D, 7},
+  {0x1E6E, 0x1E6E, 6}, {0x1E6F, 0x1E6F, 7}, {0x1E70, 0x1E70, 6}, {0x1E71, 0x1E71, 7},
+  {0x1E72, 0x1E72, 6}, {0x1E73, 0x1E73, 7}, {0x1E74, 0x1E74, 6}, {0x1E75, 0x1E75, 7},
+  {0x1E76, 0x1E76, 6}, {0x1E77, 0x1E77, 7}, {0x1E78, 0x1E78, 6}, {0x1E79, 0x1E79, 7},
+  {0x1E7A, 0x1E7A, 6}, {0x1E7B, 0x1E7B, 7}, {0x1E7C, 0x1E7C, 6}, {0x1E7D, 0x1E7D, 7},
+  {0x1E7E, 0x1E7E, 6}, {0x1E7F, 0x1E7F, 7}, {0x1E80, 0x1E80, 6}, {0x1E81, 0x1E81, 7},
+  {0x1E82, 0x1E82, 6}, {0x1E83, 0x1E83, 7}, {0x1E84, 0x1E84, 6}, {0x1E85, 0x1E85, 7},
+  {0x1E86, 0x1E86, 6}, {0x1E87, 0x1E87, 7}, {0x1E88, 0x1E88, 6}, {0x1E89, 0x1E89, 7},
+  {0x1E8A, 0x1E8A, 6}, {0x1E8B, 0x1E8B, 7}, {0x1E8C, 0x1E8C, 6}, {0x1E8D, 0x1E8D, 7},
+  {0x1E8E, 0x1E8E, 6}, {0x1E8F, 0x1E8F, 7}, {0x1E90, 0x1E90, 6}, {0x1E91, 0x1E91, 7},
+  {0x1E92, 0x1E92, 6}, {0x1E93, 0x1E93, 7}, {0x1E94, 0x1E94, 6}, {0x1E95, 0x1E95, 7},
+  {0x1E96, 0x1E9A, 3}, {0x1E9B, 0x1E9B, 120}, {0x1E9C, 0x1E9D, 3}, {0x1E9E, 0x1E9E, 121},
+  {0x1E9F, 0x1E9F, 3}, {0x1EA0, 0x1EA0, 6}, {0x1EA1, 0x1EA1, 7}, {0x1EA2, 0x1EA2, 6},
+  {0x1EA3, 0x1EA3, 7}, {0x1EA4, 0x1EA4, 6}, {0x1EA5, 0x1EA5, 7}, {0x1EA6, 0x1EA6, 6},
+  {0x1EA7, 0x1EA7, 7}, {0x1EA8, 0x1EA8, 6}, {0x1EA9, 0x1EA9, 7}, {0x1EAA, 0x1EAA, 6},
+  {0x1EAB, 0x1EAB, 7}, {0x1EAC, 0x1EAC, 6}, {0x1EAD, 0x1EAD, 7}, {0x1EAE, 0x1EAE, 6},
+  {0x1EAF, 0x1EAF, 7}, {0x1EB0, 0x1EB0, 6}, {0x1EB1, 0x1EB1, 7}, {0x1EB2, 0x1EB2, 6},
+  {0x1EB3, 0x1EB3, 7}, {0x1EB4, 0x1EB4, 6}, {0x1EB5, 0x1EB5, 7}, {0x1EB6, 0x1EB6, 6},
+  {0x1EB7, 0x1EB7, 7}, {0x1EB8, 0x1EB8, 6}, {0x1EB9, 0x1EB9, 7}, {0x1EBA, 0x1EBA, 6},
+  {0x1EBB, 0x1EBB, 7}, {0x1EBC, 0x1EBC, 6}, {0x1EBD, 0x1EBD, 7}, {0x1EBE, 0x1EBE, 6},
+  {0x1EBF, 0x1EBF, 7}, {0x1EC0, 0x1EC0, 6}, {0x1EC1, 0x1EC1, 7}, {0x1EC2, 0x1EC2, 6},
+  {0x1EC3, 0x1EC3, 7}, {0x1EC4, 0x1EC4, 6}, {0x1EC5, 0x1EC5, 7}, {0x1EC6, 0x1EC6, 6},
+  {0x1EC7, 0x1EC7, 7}, {0x1EC8, 0x1EC8, 6}, {0x1EC9, 0x1EC9, 7}, {0x1ECA, 0x1ECA, 6},
+  {0x1ECB, 0x1ECB, 7}, {0x1ECC, 0x1ECC, 6}, {0x1ECD, 0x1ECD, 7}, {0x1ECE, 0x1ECE, 6},
+  {0x1ECF, 0x1ECF, 7}, {0x1ED0, 0x1ED0, 6}, {0x1ED1, 0x1ED1, 7}, {0x1ED2, 0x1ED2, 6},
+  {0x1ED3, 0x1ED3, 7}, {0x1ED4, 0x1ED4, 6}, {0x1ED5, 0x1ED5, 7}, {0x1ED6, 0x1ED6, 6},
+  {0x1ED7, 0x1ED7, 7}, {0x1ED8, 0x1ED8, 6}, {0x1ED9, 0x1ED9, 7}, {0x1EDA, 0x1EDA, 6},
+  {0x1EDB, 0x1EDB, 7}, {0x1EDC, 0x1EDC, 6}, {0x1EDD, 0x1EDD, 7}, {0x1EDE, 0x1EDE, 6},
+  {0x1EDF, 0x1EDF, 7}, {0x1EE0, 0x1EE0, 6}, {0x1EE1, 0x1EE1, 7}, {0x1EE2, 0x1EE2, 6},
+  {0x1EE3, 0x1EE3, 7}, {0x1EE4, 0x1EE4, 6}, {0x1EE5, 0x1EE5, 7}, {0x1EE6, 0x1EE6, 6},
+  {0x1EE7, 0x1EE7, 7}, {0x1EE8, 0x1EE8, 6}, {0x1EE9, 0x1EE9, 7}, {0x1EEA, 0x1EEA, 6},
+  {0x1EEB, 0x1EEB, 7}, {0x1EEC, 0x1EEC, 6}, {0x1EED, 0x1EED, 7}, {0x1EEE, 0x1EEE, 6},
+  {0x1EEF, 0x1EEF, 7}, {0x1EF0, 0x1EF0, 6}, {0x1EF1, 0x1EF1, 7}, {0x1EF2, 0x1EF2, 6},
+  {0x1EF3, 0x1EF3, 7}, {0x1EF4, 0x1EF4, 6}, {0x1EF5, 0x1EF5, 7}, {0x1EF6, 0x1EF6, 6},
+  {0x1EF7, 0x1EF7, 7}, {0x1EF8, 0x1EF8, 6}, {0x1EF9, 0x1EF9, 7}, {0x1EFA, 0x1EFA, 6},
+  {0x1EFB, 0x1EFB, 7}, {0x1EFC, 0x1EFC, 6}, {0x1EFD, 0x1EFD, 7}, {0x1EFE, 0x1EFE, 6},
+  {0x1EFF, 0x1EFF, 7}, {0x1F00, 0x1F07, 122}, {0x1F08, 0x1F0F, 123}, {0x1F10, 0x1F15, 122},
+  {0x1F18, 0x1F1D, 123}, {0x1F20, 0x1F27, 122}, {0x1F28, 0x1F2F, 123}, {0x1F30, 0x1F37, 122},
+  {0x1F38, 0x1F3F, 123}, {0x1F40, 0x1F45, 122}, {0x1F48, 0x1F4D, 123}, {0x1F50, 0x1F50, 3},
+  {0x1F51, 0x1F51, 122}, {0x1F52, 0x1F52, 3}, {0x1F53, 0x1F53, 122}, {0x1F54, 0x1F54, 3},
+  {0x1F55, 0x1F55, 122}, {0x1F56, 0x1F56, 3}, {0x1F57, 0x1F57, 122}, {0x1F59, 0x1F59, 123},
+  {0x1F5B, 0x1F5B, 123}, {0x1F5D, 0x1F5D, 123}, {0x1F5F, 0x1F5F, 123}, {0x1F60, 0x1F67, 122},
+  {0x1F68, 0x1F6F, 123}, {0x1F70, 0x1F71, 124}, {0x1F72, 0x1F75, 125}, {0x1F76, 0x1F77, 126},
+  {0x1F78, 0x1F79, 127}, {0x1F7A, 0x1F7B, 128}, {0x1F7C, 0x1F7D, 129}, {0x1F80, 0x1F87, 122},
+  {0x1F88, 0x1F8F, 130}, {0x1F90, 0x1F97, 122}, {0x1F98, 0x1F9F, 130}, {0x1FA0, 0x1FA7, 122},
+  {0x1FA8, 0x1FAF, 130}, {0x1FB0, 0x1FB1, 122}, {0x1FB2, 0x1FB2, 3}, {0x1FB3, 0x1FB3, 131},
+  {0x1FB4, 0x1FB4, 3}, {0x1FB6, 0x1FB7, 3}, {0x1FB8, 0x1FB9, 123}, {0x1FBA, 0x1FBB, 132},
+  {0x1FBC, 0x1FBC, 133}, {0x1FBE, 0x1FBE, 134}, {0x1FC2, 0x1FC2, 3}, {0x1FC3, 0x1FC3, 131},
+  {0x1FC4, 0x1FC4, 3}, {0x1FC6, 0x1FC7, 3}, {0x1FC8, 0x1FCB, 135}, {0x1FCC, 0x1FCC, 133},
+  {0x1FD0, 0x1FD1, 122}, {0x1FD2, 0x1FD3, 3}, {0x1FD6, 0x1FD7, 3}, {0x1FD8, 0x1FD9, 123},
+  {0x1FDA, 0x1FDB, 136}, {0x1FE0, 0x1FE1, 122}, {0x1FE2, 0x1FE4, 3}, {0x1FE5, 0x1FE5, 95},
+  {0x1FE6, 0x1FE7, 3}, {0x1FE8, 0x1FE9, 123}, {0x1FEA, 0x1FEB, 137}, {0x1FEC, 0x1FEC, 99},
+  {0x1FF2, 0x1FF2, 3}, {0x1FF3, 0x1FF3, 131}, {0x1FF4, 0x1FF4, 3}, {0x1FF6, 0x1FF7, 3},
+  {0x1FF8, 0x1FF9, 138}, {0x1FFA, 0x1FFB, 139}, {0x1FFC, 0x1FFC, 133}, {0x2071, 0x2071, 3},
+  {0x207F, 0x207F, 3}, {0x2090, 0x209C, 3}, {0x2102, 0x2102, 89}, {0x2107, 0x2107, 89},
+  {0x210A, 0x210A, 3}, {0x210B, 0x210D, 89}, {0x210E, 0x210F, 3}, {0x2110, 0x2112, 89},
+  {0x2113, 0x2113, 3}, {0x2115, 0x2115, 89}, {0x2119, 0x211D, 89}, {0x2124, 0x2124, 89},
+  {0x2126, 0x2126, 140}, {0x2128, 0x2128, 89}, {0x212A, 0x212A, 141}, {0x212B, 0x212B, 142},
+  {0x212C, 0x212D, 89}, {0x212F, 0x212F, 3}, {0x2130, 0x2131, 89}, {0x2132, 0x2132, 143},
+  {0x2133, 0x2133, 89}, {0x2134, 0x2134, 3}, {0x2139, 0x2139, 3}, {0x213C, 0x213D, 3},
+  {0x213E, 0x213F, 89}, {0x2145, 0x2145, 89}, {0x2146, 0x2149, 3}, {0x214E, 0x214E, 144},
+  {0x2160, 0x216F, 145}, {0x2170, 0x217F, 146}, {0x2183, 0x2183, 6}, {0x2184, 0x2184, 7},
+  {0x24B6, 0x24CF, 147}, {0x24D0, 0x24E9, 148}, {0x2C00, 0x2C2F, 103}, {0x2C30, 0x2C5F, 104},
+  {0x2C60, 0x2C60, 6}, {0x2C61, 0x2C61, 7}, {0x2C62, 0x2C62, 149}, {0x2C63, 0x2C63, 150},
+  {0x2C64, 0x2C64, 151}, {0x2C65, 0x2C65, 152}, {0x2C66, 0x2C66, 153}, {0x2C67, 0x2C67, 6},
+  {0x2C68, 0x2C68, 7}, {0x2C69, 0x2C69, 6}, {0x2C6A, 0x2C6A, 7}, {0x2C6B, 0x2C6B, 6},
+  {0x2C6C, 0x2C6C, 7}, {0x2C6D, 0x2C6D, 154}, {0x2C6E, 0x2C6E, 155}, {0x2C6F, 0x2C6F, 156},
+  {0x2C70, 0x2C70, 157}, {0x2C71, 0x2C71, 3}, {0x2C72, 0x2C72, 6}, {0x2C73, 0x2C73, 7},
+  {0x2C74, 0x2C74, 3}, {0x2C75, 0x2C75, 6}, {0x2C76, 0x2C76, 7}, {0x2C77, 0x2C7D, 3},
+  {0x2C7E, 0x2C7F, 158}, {0x2C80, 0x2C80, 6}, {0x2C81, 0x2C81, 7}, {0x2C82, 0x2C82, 6},
+  {0x2C83, 0x2C83, 7}, {0x2C84, 0x2C84, 6}, {0x2C85, 0x2C85, 7}, {0x2C86, 0x2C86, 6},
+  {0x2C87, 0x2C87, 7}, {0x2C88, 0x2C88, 6}, {0x2C89, 0x2C89, 7}, {0x2C8A, 0x2C8A, 6},
+  {0x2C8B, 0x2C8B, 7}, {0x2C8C, 0x2C8C, 6}, {0x2C8D, 0x2C8D, 7}, {0x2C8E, 0x2C8E, 6},
+  {0x2C8F, 0x2C8F, 7}, {0x2C90, 0x2C90, 6}, {0x2C91, 0x2C91, 7}, {0x2C92, 0x2C92, 6},
+  {0x2C93, 0x2C93, 7}, {0x2C94, 0x2C94, 6}, {0x2C95, 0x2C95, 7}, {0x2C96, 0x2C96, 6},
+  {0x2C97, 0x2C97, 7}, {0x2C98, 0x2C98, 6}, {0x2C99, 0x2C99, 7}, {0x2C9A, 0x2C9A, 6},
+  {0x2C9B, 0x2C9B, 7}, {0x2C9C, 0x2C9C, 6}, {0x2C9D, 0x2C9D, 7}, {0x2C9E, 0x2C9E, 6},
+  {0x2C9F, 0x2C9F, 7}, {0x2CA0, 0x2CA0, 6}, {0x2CA1, 0x2CA1, 7}, {0x2CA2, 0x2CA2, 6},
+  {0x2CA3, 0x2CA3, 7}, {0x2CA4, 0x2CA4, 6}, {0x2CA5, 0x2CA5, 7}, {0x2CA6, 0x2CA6, 6},
+  {0x2CA7, 0x2CA7, 7}, {0x2CA8, 0x2CA8, 6}, {0x2CA9, 0x2CA9, 7}, {0x2CAA, 0x2CAA, 6},
+  {0x2CAB, 0x2CAB, 7}, {0x2CAC, 0x2CAC, 6}, {0x2CAD, 0x2CAD, 7}, {0x2CAE, 0x2CAE, 6},
+  {0x2CAF, 0x2CAF, 7}, {0x2CB0, 0x2CB0, 6}, {0x2CB1, 0x2CB1, 7}, {0x2CB2, 0x2CB2, 6},
+  {0x2CB3, 0x2CB3, 7}, {0x2CB4, 0x2CB4, 6}, {0x2CB5, 0x2CB5, 7}, {0x2CB6, 0x2CB6, 6},
+  {0x2CB7, 0x2CB7, 7}, {0x2CB8, 0x2CB8, 6}, {0x2CB9, 0x2CB9, 7}, {0x2CBA, 0x2CBA, 6},
+  {0x2CBB, 0x2CBB, 7}, {0x2CBC, 0x2CBC, 6}, {0x2CBD, 0x2CBD, 7}, {0x2CBE, 0x2CBE, 6},
+  {0x2CBF, 0x2CBF, 7}, {0x2CC0, 0x2CC0, 6}, {0x2CC1, 0x2CC1, 7}, {0x2CC2, 0x2CC2, 6},
+  {0x2CC3, 0x2CC3, 7}, {0x2CC4, 0x2CC4, 6}, {0x2CC5, 0x2CC5, 7}, {0x2CC6, 0x2CC6, 6},
+  {0x2CC7, 0x2CC7, 7}, {0x2CC8, 0x2CC8, 6}, {0x2CC9, 0x2CC9, 7}, {0x2CCA, 0x2CCA, 6},
+  {0x2CCB, 0x2CCB, 7}, {0x2CCC, 0x2CCC, 6}, {0x2CCD, 0x2CCD, 7}, {0x2CCE, 0x2CCE, 6},
+  {0x2CCF, 0x2CCF, 7}, {0x2CD0, 0x2CD0, 6}, {0x2CD1, 0x2CD1, 7}, {0x2CD2, 0x2CD2, 6},
+  {0x2CD3, 0x2CD3, 7}, {0x2CD4, 0x2CD4, 6}, {0x2CD5, 0x2CD5, 7}, {0x2CD6, 0x2CD6, 6},
+  {0x2CD7, 0x2CD7, 7}, {0x2CD8, 0x2CD8, 6}, {0x2CD9, 0x2CD9, 7}, {0x2CDA, 0x2CDA, 6},
+  {0x2CDB, 0x2CDB, 7}, {0x2CDC, 0x2CDC, 6}, {0x2CDD, 0x2CDD, 7}, {0x2CDE, 0x2CDE, 6},
+  {0x2CDF, 0x2CDF, 7}, {0x2CE0, 0x2CE0, 6}, {0x2CE1, 0x2CE1, 7}, {0x2CE2, 0x2CE2, 6},
+  {0x2CE3, 0x2CE3, 7}, {0x2CE4, 0x2CE4, 3}, {0x2CEB, 0x2CEB, 6}, {0x2CEC, 0x2CEC, 7},
+  {0x2CED, 0x2CED, 6}, {0x2CEE, 0x2CEE, 7}, {0x2CF2, 0x2CF2, 6}, {0x2CF3, 0x2CF3, 7},
+  {0x2D00, 0x2D25, 159}, {0x2D27, 0x2D27, 159}, {0x2D2D, 0x2D2D, 159}, {0xA640, 0xA640, 6},
+  {0xA641, 0xA641, 7}, {0xA642, 0xA642, 6}, {0xA643, 0xA643, 7}, {0xA644, 0xA644, 6},
+  {0xA645, 0xA645, 7}, {0xA646, 0xA646, 6}, {0xA647, 0xA647, 7}, {0xA648, 0xA648, 6},
+  {0xA649, 0xA649, 7}, {0xA64A, 0xA64A, 6}, {0xA64B, 0xA64B, 7}, {0xA64C, 0xA64C, 6},
+  {0xA64D, 0xA64D, 7}, {0xA64E, 0xA64E, 6}, {0xA64F, 0xA64F, 7}, {0xA650, 0xA650, 6},
+  {0xA651, 0xA651, 7}, {0xA652, 0xA652, 6}, {0xA653, 0xA653, 7}, {0xA654, 0xA654, 6},
+  {0xA655, 0xA655, 7}, {0xA656, 0xA656, 6}, {0xA657, 0xA657, 7}, {0xA658, 0xA658, 6},
+  {0xA659, 0xA659, 7}, {0xA65A, 0xA65A, 6}, {0xA65B, 0xA65B, 7}, {0xA65C, 0xA65C, 6},
+  {0xA65D, 0xA65D, 7}, {0xA65E, 0xA65E, 6}, {0xA65F, 0xA65F, 7}, {0xA660, 0xA660, 6},
+  {0xA661, 0xA661, 7}, {0xA662, 0xA662, 6}, {0xA663, 0xA663, 7}, {0xA664, 0xA664, 6},
+  {0xA665, 0xA665, 7}, {0xA666, 0xA666, 6}, {0xA667, 0xA667, 7}, {0xA668, 0xA668, 6},
+  {0xA669, 0xA669, 7}, {0xA66A, 0xA66A, 6}, {0xA66B, 0xA66B, 7}, {0xA66C, 0xA66C, 6},
+  {0xA66D, 0xA66D, 7}, {0xA680, 0xA680, 6}, {0xA681, 0xA681, 7}, {0xA682, 0xA682, 6},
+  {0xA683, 0xA683, 7}, {0xA684, 0xA684, 6}, {0xA685, 0xA685, 7}, {0xA686, 0xA686, 6},
+  {0xA687, 0xA687, 7}, {0xA688, 0xA688, 6}, {0xA689, 0xA689, 7}, {0xA68A, 0xA68A, 6},
+  {0xA68B, 0xA68B, 7}, {0xA68C, 0xA68C, 6}, {0xA68D, 0xA68D, 7}, {0xA68E, 0xA68E, 6},
+  {0xA68F, 0xA68F, 7}, {0xA690, 0xA690, 6}, {0xA691, 0xA691, 7}, {0xA692, 0xA692, 6},
+  {0xA693, 0xA693, 7}, {0xA694, 0xA694, 6}, {0xA695, 0xA695, 7}, {0xA696, 0xA696, 6},
+  {0xA697, 0xA697, 7}, {0xA698, 0xA698, 6}, {0xA699, 0xA699, 7}, {0xA69A, 0xA69A, 6},
+  {0xA69B, 0xA69B, 7}, {0xA69C, 0xA69D, 3}, {0xA722, 0xA722, 6}, {0xA723, 0xA723, 7},
+  {0xA724, 0xA724, 6}, {0xA725, 0xA725, 7}, {0xA726, 0xA726, 6}, {0xA727, 0xA727, 7},
+  {0xA728, 0xA728, 6}, {0xA729, 0xA729, 7}, {0xA72A, 0xA72A, 6}, {0xA72B, 0xA72B, 7},
+  {0xA72C, 0xA72C, 6}, {0xA72D, 0xA72D, 7}, {0xA72E, 0xA72E, 6}, {0xA72F, 0xA72F, 7},
+  {0xA730, 0xA731, 3}, {0xA732, 0xA732, 6}, {0xA733, 0xA733, 7}, {0xA734, 0xA734, 6},
+  {0xA735, 0xA735, 7}, {0xA736, 0xA736, 6}, {0xA737, 0xA737, 7}, {0xA738, 0xA738, 6},
+  {0xA739, 0xA739, 7}, {0xA73A, 0xA73A, 6}, {0xA73B, 0xA73B, 7}, {0xA73C, 0xA73C, 6},
+  {0xA73D, 0xA73D, 7}, {0xA73E, 0xA73E, 6}, {0xA73F, 0xA73F, 7}, {0xA740, 0xA740, 6},
+  {0xA741, 0xA741, 7}, {0xA742, 0xA742, 6}, {0xA743, 0xA743, 7}, {0xA744, 0xA744, 6},
+  {0xA745, 0xA745, 7}, {0xA746, 0xA746, 6}, {0xA747, 0xA747, 7}, {0xA748, 0xA748, 6},
+  {0xA749, 0xA749, 7}, {0xA74A, 0xA74A, 6}, {0xA74B, 0xA74B, 7}, {0xA74C, 0xA74C, 6},
+  {0xA74D, 0xA74D, 7}, {0xA74E, 0xA74E, 6}, {0xA74F, 0xA74F, 7}, {0xA750, 0xA750, 6},
+  {0xA751, 0xA751, 7}, {0xA752, 0xA752, 6}, {0xA753, 0xA753, 7}, {0xA754, 0xA754, 6},
+  {0xA755, 0xA755, 7}, {0xA756, 0xA756, 6}, {0xA757, 0xA757, 7}, {0xA758, 0xA758, 6},
+  {0xA759, 0xA759, 7}, {0xA75A, 0xA75A, 6}, {0xA75B, 0xA75B, 7}, {0xA75C, 0xA75C, 6},
+  {0xA75D, 0xA75D, 7}, {0xA75E, 0xA75E, 6}, {0xA75F, 0xA75F, 7}, {0xA760, 0xA760, 6},
+  {0xA761, 0xA761, 7}, {0xA762, 0xA762, 6}, {0xA763, 0xA763, 7}, {0xA764, 0xA764, 6},
+  {0xA765, 0xA765, 7}, {0xA766, 0xA766, 6}, {0xA767, 0xA767, 7}, {0xA768, 0xA768, 6},
+  {0xA769, 0xA769, 7}, {0xA76A, 0xA76A, 6}, {0xA76B, 0xA76B, 7}, {0xA76C, 0xA76C, 6},
+  {0xA76D, 0xA76D, 7}, {0xA76E, 0xA76E, 6}, {0xA76F, 0xA76F, 7}, {0xA770, 0xA778, 3},
+  {0xA779, 0xA779, 6}, {0xA77A, 0xA77A, 7}, {0xA77B, 0xA77B, 6}, {0xA77C, 0xA77C, 7},
+  {0xA77D, 0xA77D, 160}, {0xA77E, 0xA77E, 6}, {0xA77F, 0xA77F, 7}, {0xA780, 0xA780, 6},
+  {0xA781, 0xA781, 7}, {0xA782, 0xA782, 6}, {0xA783, 0xA783, 7}, {0xA784, 0xA784, 6},
+  {0xA785, 0xA785, 7}, {0xA786, 0xA786, 6}, {0xA787, 0xA787, 7}, {0xA78B, 0xA78B, 6},
+  {0xA78C, 0xA78C, 7}, {0xA78D, 0xA78D, 161}, {0xA78E, 0xA78E, 3}, {0xA790, 0xA790, 6},
+  {0xA791, 0xA791, 7}, {0xA792, 0xA792, 6}, {0xA793, 0xA793, 7}, {0xA794, 0xA794, 162},
+  {0xA795, 0xA795, 3}, {0xA796, 0xA796, 6}, {0xA797, 0xA797, 7}, {0xA798, 0xA798, 6},
+  {0xA799, 0xA799, 7}, {0xA79A, 0xA79A, 6}, {0xA79B, 0xA79B, 7}, {0xA79C, 0xA79C, 6},
+  {0xA79D, 0xA79D, 7}, {0xA79E, 0xA79E, 6}, {0xA79F, 0xA79F, 7}, {0xA7A0, 0xA7A0, 6},
+  {0xA7A1, 0xA7A1, 7}, {0xA7A2, 0xA7A2, 6}, {0xA7A3, 0xA7A3, 7}, {0xA7A4, 0xA7A4, 6},
+  {0xA7A5, 0xA7A5, 7}, {0xA7A6, 0xA7A6, 6}, {0xA7A7, 0xA7A7, 7}, {0xA7A8, 0xA7A8, 6},
+  {0xA7A9, 0xA7A9, 7}, {0xA7AA, 0xA7AA, 163}, {0xA7AB, 0xA7AB, 164}, {0xA7AC, 0xA7AC, 165},
+  {0xA7AD, 0xA7AD, 166}, {0xA7AE, 0xA7AE, 163}, {0xA7AF, 0xA7AF, 3}, {0xA7B0, 0xA7B0, 167},
+  {0xA7B1, 0xA7B1, 168}, {0xA7B2, 0xA7B2, 169}, {0xA7B3, 0xA7B3, 170}, {0xA7B4, 0xA7B4, 6},
+  {0xA7B5, 0xA7B5, 7}, {0xA7B6, 0xA7B6, 6}, {0xA7B7, 0xA7B7, 7}, {0xA7B8, 0xA7B8, 6},
+  {0xA7B9, 0xA7B9, 7}, {0xA7BA, 0xA7BA, 6}, {0xA7BB, 0xA7BB, 7}, {0xA7BC, 0xA7BC, 6},
+  {0xA7BD, 0xA7BD, 7}, {0xA7BE, 0xA7BE, 6}, {0xA7BF, 0xA7BF, 7}, {0xA7C0, 0xA7C0, 6},
+  {0xA7C1, 0xA7C1, 7}, {0xA7C2, 0xA7C2, 6}, {0xA7C3, 0xA7C3, 7}, {0xA7C4, 0xA7C4, 171},
+  {0xA7C5, 0xA7C5, 172}, {0xA7C6, 0xA7C6, 173}, {0xA7C7, 0xA7C7, 6}, {0xA7C8, 0xA7C8, 7},
+  {0xA7C9, 0xA7C9, 6}, {0xA7CA, 0xA7CA, 7}, {0xA7D0, 0xA7D0, 6}, {0xA7D1, 0xA7D1, 7},
+  {0xA7D3, 0xA7D3, 3}, {0xA7D5, 0xA7D5, 3}, {0xA7D6, 0xA7D6, 6}, {0xA7D7, 0xA7D7, 7},
+  {0xA7D8, 0xA7D8, 6}, {0xA7D9, 0xA7D9, 7}, {0xA7F5, 0xA7F5, 6}, {0xA7F6, 0xA7F6, 7},
+  {0xA7F8, 0xA7FA, 3}, {0xAB30, 0xAB52, 3}, {0xAB53, 0xAB53, 174}, {0xAB54, 0xAB5A, 3},
+  {0xAB5C, 0xAB68, 3}, {0xAB70, 0xABBF, 175}, {0xFB00, 0xFB06, 3}, {0xFB13, 0xFB17, 3},
+  {0xFF21, 0xFF3A, 1}, {0xFF41, 0xFF5A, 2},
+};
+} // namespace case_data
@@ -0,0 +1,89 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "CaseTables.h"
+
+#include "CaseData.h"
+#include "string_utils.h"
+
+#include <array>
+#include <iterator>
+
+namespace {
+constexpr char32_t bmp_size = 0x10000;
+// BMP is split into blocks, each of them refers to a row of record indices. Blocks without any cased characters share the first row.
+constexpr char32_t block_size = 128;
+constexpr size_t block_count = bmp_size / block_size;
+constexpr size_t range_count = std::size(case_data::ranges);
+
+static_assert(std::size(case_data::records) <= 0x100, "record indices are stored in bytes");
+
+constexpr size_t count_rows() {
+  size_t count = 1;
+  size_t last_block = block_count;
+  for (const auto &range : case_data::ranges)
+    for (size_t block = range.first / block_size; block <= range.last / block_size; ++block)
+      if (block != last_block) {
+        ++count;
+        last_block = block;
+      }
+  return count;
+}
+
+struct CaseTables {
+  std::array<uint8_t, block_count> block_rows = {};
+  std::array<std::array<uint8_t, block_size>, count_rows()> rows = {};
+};
+
+constexpr CaseTables build_tables() {
+  CaseTables tables;
+  size_t next_row = 1;
+  size_t range = 0;
+  for (size_t block = 0; block < block_count; ++block) {
+    const auto first = static_cast<char32_t>(block * block_size);
+    const char32_t last = first + block_size - 1;
+    if (range == range_count || case_data::ranges[range].first > last)
+      continue;
+    auto &row = tables.rows[next_row];
+    tables.block_rows[block] = static_cast<uint8_t>(next_row++);
+    for (; range < range_count && case_data::ranges[range].first <= last; ++range) {
+      const auto &r = case_data::ranges[range];
+      for (auto c = std::max<char32_t>(r.first, first); c <= std::min<char32_t>(r.last, last); ++c)
+        row[c - first] = r.record;
+      // range continues in the next block
+      if (r.last > last)
+        break;
+    }
+  }
+  return tables;
+}
+
+constexpr CaseTables tables = build_tables();
+static_assert(tables.rows.size() <= 0x100, "row indices are stored in bytes");
+} // namespace
+
+const CaseRecord &case_record(wchar_t c) {
+  const auto code = static_cast<char32_t>(c);
+  if (code >= bmp_size)
+    return case_data::records[0];
+  return case_data::records[tables.rows[tables.block_rows[code / block_size]][code % block_size]];
+}
+
+wchar_t make_upper(wchar_t c) { return static_cast<wchar_t>(c + case_record(c).to_upper); }
+
+wchar_t make_lower(wchar_t c) { return static_cast<wchar_t>(c + case_record(c).to_lower); }
+
+bool is_upper(wchar_t c) { return case_record(c).kind == CaseKind::upper; }
+
+bool is_lower(wchar_t c) { return case_record(c).kind == CaseKind::lower; }
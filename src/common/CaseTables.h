@@ -0,0 +1,41 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include <cstdint>
+
+// Classification of characters by Uppercase and Lowercase properties of Unicode, titlecase letters are neither
+enum class CaseKind : uint8_t {
+  none,
+  upper,
+  lower,
+};
+
+struct CaseRecord {
+  CaseKind kind;
+  // offsets to add to the character to get its simple case mappings
+  int32_t to_upper;
+  int32_t to_lower;
+};
+
+struct CaseRange {
+  char16_t first;
+  char16_t last;
+  uint8_t record;
+};
+
+// Looks the character up in two-level table built at compile time from CaseData.h.
+// is_upper(), is_lower(), make_upper() and make_lower() from string_utils.h use it instead of WinAPI calls.
+const CaseRecord &case_record(wchar_t c);
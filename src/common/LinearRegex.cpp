@@ -0,0 +1,659 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "LinearRegex.h"
+
+#include <algorithm>
+
+namespace {
+// patterns which need more states are left to std::wregex
+constexpr size_t max_state_count = 4096;
+constexpr int max_repetition_count = 1000;
+// after that many DFA states matching falls back to NFA simulation
+constexpr size_t max_dfa_state_count = 1024;
+
+struct Node {
+  enum class Type {
+    sequence,
+    alternation,
+    repetition,
+    char_set,
+    line_begin,
+    line_end,
+  };
+
+  Type type = Type::sequence;
+  int char_set = -1;
+  int min_count = 0;
+  int max_count = -1; // -1 means no limit
+  std::vector<Node> children;
+};
+
+bool is_ascii_alnum(wchar_t c) { return (c >= L'a' && c <= L'z') || (c >= L'A' && c <= L'Z') || (c >= L'0' && c <= L'9'); }
+
+std::optional<int> hex_digit_value(wchar_t c) {
+  if (c >= L'0' && c <= L'9')
+    return c - L'0';
+  if (c >= L'a' && c <= L'f')
+    return c - L'a' + 10;
+  if (c >= L'A' && c <= L'F')
+    return c - L'A' + 10;
+  return std::nullopt;
+}
+} // namespace
+
+class LinearRegex::Parser {
+public:
+  Parser(std::wstring_view pattern, LinearRegex &regex) : m_pattern(pattern), m_regex(regex) {}
+
+  std::optional<Node> parse() {
+    auto node = parse_alternation();
+    if (!node || !at_end())
+      return std::nullopt;
+    return node;
+  }
+
+private:
+  bool at_end() const { return m_pos >= m_pattern.size(); }
+  wchar_t peek() const { return m_pattern[m_pos]; }
+
+  Node char_set_node(CharSet set) {
+    Node node;
+    node.type = Node::Type::char_set;
+    node.char_set = static_cast<int>(m_regex.m_char_sets.size());
+    m_regex.m_char_sets.push_back(std::move(set));
+    return node;
+  }
+
+  std::optional<Node> parse_alternation() {
+    auto first = parse_sequence();
+    if (!first)
+      return std::nullopt;
+    if (at_end() || peek() != L'|')
+      return first;
+
+    Node node;
+    node.type = Node::Type::alternation;
+    node.children.push_back(std::move(*first));
+    while (!at_end() && peek() == L'|') {
+      ++m_pos;
+      auto next = parse_sequence();
+      if (!next)
+        return std::nullopt;
+      node.children.push_back(std::move(*next));
+    }
+    return node;
+  }
+
+  std::optional<Node> parse_sequence() {
+    Node node;
+    while (!at_end() && peek() != L'|' && peek() != L')') {
+      auto item = parse_quantified();
+      if (!item)
+        return std::nullopt;
+      node.children.push_back(std::move(*item));
+    }
+    return node;
+  }
+
+  std::optional<Node> parse_quantified() {
+    auto atom = parse_atom();
+    if (!atom || at_end())
+      return atom;
+
+    int min_count = 0;
+    int max_count = -1;
+    switch (peek()) {
+    case L'*':
+      ++m_pos;
+      break;
+    case L'+':
+      ++m_pos;
+      min_count = 1;
+      break;
+    case L'?':
+      ++m_pos;
+      max_count = 1;
+      break;
+    case L'{':
+      if (!parse_braces(min_count, max_count))
+        return std::nullopt;
+      break;
+    default:
+      return atom;
+    }
+    if (atom->type == Node::Type::line_begin || atom->type == Node::Type::line_end)
+      return std::nullopt;
+    // lazy quantifiers don't change the result of the full match
+    if (!at_end() && peek() == L'?')
+      ++m_pos;
+    if (!at_end() && (peek() == L'*' || peek() == L'+' || peek() == L'?' || peek() == L'{'))
+      return std::nullopt;
+
+    Node node;
+    node.type = Node::Type::repetition;
+    node.min_count = min_count;
+    node.max_count = max_count;
+    node.children.push_back(std::move(*atom));
+    return node;
+  }
+
+  std::optional<int> parse_number() {
+    if (at_end() || peek() < L'0' || peek() > L'9')
+      return std::nullopt;
+    int value = 0;
+    while (!at_end() && peek() >= L'0' && peek() <= L'9') {
+      value = value * 10 + (peek() - L'0');
+      if (value > max_repetition_count)
+        return std::nullopt;
+      ++m_pos;
+    }
+    return value;
+  }
+
+  bool parse_braces(int &min_count, int &max_count) {
+    ++m_pos;
+    auto min_value = parse_number();
+    if (!min_value)
+      return false;
+    min_count = *min_value;
+    max_count = min_count;
+    if (!at_end() && peek() == L',') {
+      ++m_pos;
+      max_count = -1;
+      if (!at_end() && peek() != L'}') {
+        auto max_value = parse_number();
+        if (!max_value || *max_value < min_count)
+          return false;
+        max_count = *max_value;
+      }
+    }
+    if (at_end() || peek() != L'}')
+      return false;
+    ++m_pos;
+    return true;
+  }
+
+  std::optional<Node> parse_atom() {
+    auto c = m_pattern[m_pos++];
+    switch (c) {
+    case L'(': {
+      if (!at_end() && peek() == L'?') {
+        // only non-capturing groups, lookahead assertions are not supported
+        if (m_pos + 1 >= m_pattern.size() || m_pattern[m_pos + 1] != L':')
+          return std::nullopt;
+        m_pos += 2;
+      }
+      auto inner = parse_alternation();
+      if (!inner || at_end() || peek() != L')')
+        return std::nullopt;
+      ++m_pos;
+      return inner;
+    }
+    case L'[':
+      return parse_class();
+    case L'.': {
+      CharSet set;
+      set.is_negated = true;
+      set.ranges = {{L'\n', L'\n'}, {L'\r', L'\r'}, {L'\x2028', L'\x2029'}};
+      return char_set_node(std::move(set));
+    }
+    case L'^': {
+      Node node;
+      node.type = Node::Type::line_begin;
+      return node;
+    }
+    case L'$': {
+      Node node;
+      node.type = Node::Type::line_end;
+      return node;
+    }
+    case L'\\': {
+      CharSet set;
+      std::optional<wchar_t> single_char;
+      if (!parse_escape(set, single_char, false))
+        return std::nullopt;
+      if (single_char)
+        set.ranges.push_back({*single_char, *single_char});
+      return char_set_node(std::move(set));
+    }
+    case L'*':
+    case L'+':
+    case L'?':
+    case L'{':
+    case L'}':
+    case L']':
+    case L')':
+      return std::nullopt;
+    default: {
+      CharSet set;
+      set.ranges.push_back({c, c});
+      return char_set_node(std::move(set));
+    }
+    }
+  }
+
+  // Either adds class to the set or returns escaped character in `single_char`
+  bool parse_escape(CharSet &set, std::optional<wchar_t> &single_char, bool in_class) {
+    if (at_end())
+      return false;
+    auto c = m_pattern[m_pos++];
+    single_char.reset();
+    auto add_class = [&](const wchar_t *name, bool is_negated) {
+      auto name_end = name + wcslen(name);
+      (is_negated ? set.negated_classes : set.classes).push_back(m_regex.m_traits.lookup_classname(name, name_end));
+      return true;
+    };
+    switch (c) {
+    case L'd':
+      return add_class(L"d", false);
+    case L'D':
+      return add_class(L"d", true);
+    case L'w':
+      return add_class(L"w", false);
+    case L'W':
+      return add_class(L"w", true);
+    case L's':
+      return add_class(L"s", false);
+    case L'S':
+      return add_class(L"s", true);
+    case L'b':
+      // word boundary outside of class
+      if (!in_class)
+        return false;
+      single_char = L'\b';
+      return true;
+    case L't':
+      single_char = L'\t';
+      return true;
+    case L'n':
+      single_char = L'\n';
+      return true;
+    case L'r':
+      single_char = L'\r';
+      return true;
+    case L'v':
+      single_char = L'\v';
+      return true;
+    case L'f':
+      single_char = L'\f';
+      return true;
+    case L'0':
+      if (!at_end() && peek() >= L'0' && peek() <= L'9')
+        return false;
+      single_char = L'\0';
+      return true;
+    case L'x':
+    case L'u': {
+      auto digit_count = c == L'x' ? 2 : 4;
+      int value = 0;
+      for (int i = 0; i < digit_count; ++i) {
+        auto digit = at_end() ? std::nullopt : hex_digit_value(peek());
+        if (!digit)
+          return false;
+        value = value * 16 + *digit;
+        ++m_pos;
+      }
+      single_char = static_cast<wchar_t>(value);
+      return true;
+    }
+    case L'c':
+      if (at_end() || !is_ascii_alnum(peek()) || (peek() >= L'0' && peek() <= L'9'))
+        return false;
+      single_char = static_cast<wchar_t>(m_pattern[m_pos++] % 32);
+      return true;
+    default:
+      // back references and other escaped letters are not supported, escaped punctuation means itself
+      if (is_ascii_alnum(c))
+        return false;
+      single_char = c;
+      return true;
+    }
+  }
+
+  std::optional<Node> parse_class() {
+    CharSet set;
+    if (!at_end() && peek() == L'^') {
+      set.is_negated = true;
+      ++m_pos;
+    }
+    // implementations disagree on the meaning of empty classes
+    if (!at_end() && peek() == L']')
+      return std::nullopt;
+    while (true) {
+      if (at_end())
+        return std::nullopt;
+      auto c = m_pattern[m_pos++];
+      if (c == L']')
+        break;
+      std::optional<wchar_t> first;
+      if (c == L'\\') {
+        if (!parse_escape(set, first, true))
+          return std::nullopt;
+        if (!first)
+          continue;
+      } else if (c == L'[') {
+        // posix classes, equivalence classes and collating elements
+        if (!at_end() && (peek() == L':' || peek() == L'=' || peek() == L'.'))
+          return std::nullopt;
+        first = c;
+      } else
+        first = c;
+
+      if (m_pos + 1 < m_pattern.size() && peek() == L'-' && m_pattern[m_pos + 1] != L']') {
+        ++m_pos;
+        auto d = m_pattern[m_pos++];
+        std::optional<wchar_t> last;
+        if (d == L'\\') {
+          if (!parse_escape(set, last, true) || !last)
+            return std::nullopt;
+        } else if (d == L'[')
+          return std::nullopt;
+        else
+          last = d;
+        if (*last < *first)
+          return std::nullopt;
+        set.ranges.push_back({*first, *last});
+      } else
+        set.ranges.push_back({*first, *first});
+    }
+    return char_set_node(std::move(set));
+  }
+
+private:
+  std::wstring_view m_pattern;
+  size_t m_pos = 0;
+  LinearRegex &m_regex;
+};
+
+class LinearRegex::Compiler {
+  // Not yet connected exits of the fragment: (state, is it `out_alt`)
+  using Exits = std::vector<std::pair<int, bool>>;
+
+  struct Fragment {
+    int start = -1;
+    Exits exits;
+  };
+
+public:
+  explicit Compiler(LinearRegex &regex) : m_regex(regex) {}
+
+  bool compile(const Node &node) {
+    auto fragment = build(node);
+    if (!fragment)
+      return false;
+    State match;
+    match.type = StateType::match;
+    auto match_state = add_state(match);
+    if (!match_state)
+      return false;
+    connect(fragment->exits, *match_state);
+    m_regex.m_start = fragment->start;
+    return true;
+  }
+
+private:
+  std::optional<int> add_state(const State &state) {
+    if (m_regex.m_states.size() >= max_state_count)
+      return std::nullopt;
+    m_regex.m_states.push_back(state);
+    return static_cast<int>(m_regex.m_states.size()) - 1;
+  }
+
+  void connect(const Exits &exits, int target) {
+    for (auto [state, is_alt] : exits)
+      (is_alt ? m_regex.m_states[state].out_alt : m_regex.m_states[state].out) = target;
+  }
+
+  std::optional<Fragment> single_state(StateType type, int char_set = -1) {
+    State state;
+    state.type = type;
+    state.char_set = char_set;
+    auto index = add_state(state);
+    if (!index)
+      return std::nullopt;
+    return Fragment{*index, {{*index, false}}};
+  }
+
+  // state with a single epsilon transition
+  std::optional<Fragment> empty() { return single_state(StateType::split); }
+
+  std::optional<Fragment> sequence(std::optional<Fragment> first, const Node &next) {
+    if (!first)
+      return std::nullopt;
+    auto second = build(next);
+    if (!second)
+      return std::nullopt;
+    connect(first->exits, second->start);
+    first->exits = std::move(second->exits);
+    return first;
+  }
+
+  std::optional<Fragment> optional(const Node &node, bool is_repeated) {
+    auto split = single_state(StateType::split);
+    auto body = build(node);
+    if (!split || !body)
+      return std::nullopt;
+    m_regex.m_states[split->start].out = body->start;
+    if (is_repeated)
+      connect(body->exits, split->start);
+    else
+      split->exits.insert(split->exits.end(), body->exits.begin(), body->exits.end());
+    split->exits.front() = {split->start, true};
+    return split;
+  }
+
+  std::optional<Fragment> build(const Node &node) {
+    switch (node.type) {
+    case Node::Type::sequence: {
+      auto result = empty();
+      for (auto &child : node.children)
+        result = sequence(std::move(result), child);
+      return result;
+    }
+    case Node::Type::alternation: {
+      auto result = build(node.children.front());
+      for (size_t i = 1; result && i < node.children.size(); ++i) {
+        auto split = single_state(StateType::split);
+        auto next = build(node.children[i]);
+        if (!split || !next)
+          return std::nullopt;
+        m_regex.m_states[split->start].out = result->start;
+        m_regex.m_states[split->start].out_alt = next->start;
+        split->exits = std::move(result->exits);
+        split->exits.insert(split->exits.end(), next->exits.begin(), next->exits.end());
+        result = std::move(split);
+      }
+      return result;
+    }
+    case Node::Type::repetition: {
+      auto &child = node.children.front();
+      auto result = empty();
+      for (int i = 0; result && i < node.min_count; ++i)
+        result = sequence(std::move(result), child);
+      if (!result)
+        return std::nullopt;
+      auto optional_count = node.max_count < 0 ? 1 : node.max_count - node.min_count;
+      for (int i = 0; i < optional_count; ++i) {
+        auto tail = optional(child, node.max_count < 0);
+        if (!tail)
+          return std::nullopt;
+        connect(result->exits, tail->start);
+        result->exits = std::move(tail->exits);
+      }
+      return result;
+    }
+    case Node::Type::char_set:
+      return single_state(StateType::char_set, node.char_set);
+    case Node::Type::line_begin:
+      return single_state(StateType::line_begin);
+    case Node::Type::line_end:
+      return single_state(StateType::line_end);
+    }
+    return std::nullopt;
+  }
+
+private:
+  LinearRegex &m_regex;
+};
+
+bool LinearRegex::CharSet::matches(wchar_t c, const Traits &traits) const {
+  auto result = std::any_of(ranges.begin(), ranges.end(), [c](const auto &range) { return range[0] <= c && c <= range[1]; }) ||
+                std::any_of(classes.begin(), classes.end(), [&](auto char_class) { return traits.isctype(c, char_class); }) ||
+                std::any_of(negated_classes.begin(), negated_classes.end(), [&](auto char_class) { return !traits.isctype(c, char_class); });
+  return result != is_negated;
+}
+
+std::optional<LinearRegex> LinearRegex::compile(std::wstring_view pattern) {
+  LinearRegex regex;
+  auto node = Parser(pattern, regex).parse();
+  if (!node || !Compiler(regex).compile(*node))
+    return std::nullopt;
+  return regex;
+}
+
+void LinearRegex::start_new_set() const {
+  if (m_marks.size() != m_states.size())
+    m_marks.assign(m_states.size(), 0);
+  ++m_generation;
+}
+
+void LinearRegex::add_with_closure(std::vector<int> &list, int state, bool is_begin, bool is_end) const {
+  m_stack.push_back(state);
+  while (!m_stack.empty()) {
+    auto index = m_stack.back();
+    m_stack.pop_back();
+    if (index < 0 || m_marks[index] == m_generation)
+      continue;
+    m_marks[index] = m_generation;
+    auto &cur = m_states[index];
+    switch (cur.type) {
+    case StateType::split:
+      m_stack.push_back(cur.out_alt);
+      m_stack.push_back(cur.out);
+      break;
+    case StateType::line_begin:
+      if (is_begin)
+        m_stack.push_back(cur.out);
+      break;
+    case StateType::line_end:
+      if (is_end)
+        m_stack.push_back(cur.out);
+      else
+        list.push_back(index);
+      break;
+    case StateType::char_set:
+    case StateType::match:
+      list.push_back(index);
+      break;
+    }
+  }
+}
+
+bool LinearRegex::has_match(const std::vector<int> &nfa_states, bool is_begin) const {
+  std::vector<int> final_states;
+  start_new_set();
+  for (auto index : nfa_states)
+    add_with_closure(final_states, index, is_begin, true);
+  return std::any_of(final_states.begin(), final_states.end(), [this](int index) { return m_states[index].type == StateType::match; });
+}
+
+std::optional<int> LinearRegex::dfa_state_for(std::vector<int> nfa_states) const {
+  if (nfa_states.empty())
+    return dead_dfa_state;
+  std::sort(nfa_states.begin(), nfa_states.end());
+  if (auto it = m_dfa_state_indices.find(nfa_states); it != m_dfa_state_indices.end())
+    return it->second;
+  if (m_dfa_states.size() >= max_dfa_state_count)
+    return std::nullopt;
+
+  DfaState state;
+  state.is_accepting = has_match(nfa_states, false);
+  state.ascii_transitions.fill(unknown_dfa_state);
+  state.nfa_states = nfa_states;
+  auto index = static_cast<int>(m_dfa_states.size());
+  m_dfa_states.push_back(std::move(state));
+  m_dfa_state_indices.emplace(std::move(nfa_states), index);
+  return index;
+}
+
+std::optional<int> LinearRegex::dfa_transition(int dfa_state, wchar_t c) const {
+  auto is_ascii = c < 128;
+  if (is_ascii) {
+    if (auto target = m_dfa_states[dfa_state].ascii_transitions[c]; target != unknown_dfa_state)
+      return target;
+  } else if (auto &other = m_dfa_states[dfa_state].other_transitions; !other.empty()) {
+    if (auto it = other.find(c); it != other.end())
+      return it->second;
+  }
+
+  std::vector<int> next;
+  start_new_set();
+  for (auto index : m_dfa_states[dfa_state].nfa_states) {
+    auto &state = m_states[index];
+    if (state.type == StateType::char_set && m_char_sets[state.char_set].matches(c, m_traits))
+      add_with_closure(next, state.out, false, false);
+  }
+  auto target = dfa_state_for(std::move(next));
+  if (!target)
+    return std::nullopt;
+  // m_dfa_states could be reallocated by dfa_state_for
+  if (is_ascii)
+    m_dfa_states[dfa_state].ascii_transitions[c] = *target;
+  else
+    m_dfa_states[dfa_state].other_transitions.emplace(c, *target);
+  return target;
+}
+
+bool LinearRegex::full_match_by_nfa(std::wstring_view str) const {
+  std::vector<int> current, next;
+  start_new_set();
+  add_with_closure(current, m_start, true, str.empty());
+  for (size_t i = 0; i < str.size() && !current.empty(); ++i) {
+    next.clear();
+    start_new_set();
+    for (auto index : current) {
+      auto &state = m_states[index];
+      if (state.type == StateType::char_set && m_char_sets[state.char_set].matches(str[i], m_traits))
+        add_with_closure(next, state.out, false, i + 1 == str.size());
+    }
+    std::swap(current, next);
+  }
+  return std::any_of(current.begin(), current.end(), [this](int index) { return m_states[index].type == StateType::match; });
+}
+
+bool LinearRegex::full_match(std::wstring_view str) const {
+  // `^` and `$` at the same position are not expressible in DFA states
+  if (str.empty())
+    return full_match_by_nfa(str);
+
+  if (!m_dfa_start) {
+    std::vector<int> start_states;
+    start_new_set();
+    add_with_closure(start_states, m_start, true, false);
+    m_dfa_start = dfa_state_for(std::move(start_states));
+    if (!m_dfa_start)
+      return full_match_by_nfa(str);
+  }
+  auto state = *m_dfa_start;
+  for (auto c : str) {
+    if (state == dead_dfa_state)
+      return false;
+    auto next = dfa_transition(state, c);
+    if (!next)
+      return full_match_by_nfa(str);
+    state = *next;
+  }
+  return state != dead_dfa_state && m_dfa_states[state].is_accepting;
+}
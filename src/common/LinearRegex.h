@@ -0,0 +1,103 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <optional>
+#include <regex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Matcher for a subset of ECMAScript regular expressions which works in time linear to the length of the string.
+// Pattern is compiled to Thompson NFA (see https://swtch.com/~rsc/regexp/regexp1.html) which is turned into DFA lazily
+// while matching, so repeated matches mostly cost a table lookup per character.
+// Supported: literals, escapes, `.`, character classes, groups, alternation, greedy and lazy quantifiers, `^` and `$`.
+// Anything else (back references, lookahead, word boundaries) makes `compile` return nullopt, std::wregex should be used then.
+// Matching semantics is the one of std::regex_match with default flags, character classes use std::regex_traits.
+// DFA is cached inside, so matching the same object from several threads simultaneously is not allowed.
+class LinearRegex {
+  using Traits = std::regex_traits<wchar_t>;
+
+public:
+  static std::optional<LinearRegex> compile(std::wstring_view pattern);
+  bool full_match(std::wstring_view str) const;
+
+private:
+  class CharSet {
+  public:
+    bool matches(wchar_t c, const Traits &traits) const;
+
+  public:
+    std::vector<std::array<wchar_t, 2>> ranges; // inclusive
+    std::vector<Traits::char_class_type> classes;
+    std::vector<Traits::char_class_type> negated_classes;
+    bool is_negated = false;
+  };
+
+  enum class StateType {
+    char_set,
+    split,
+    line_begin,
+    line_end,
+    match,
+  };
+
+  struct State {
+    StateType type = StateType::match;
+    int char_set = -1;
+    int out = -1;
+    int out_alt = -1; // only for split
+  };
+
+  static constexpr int dead_dfa_state = -1;
+  static constexpr int unknown_dfa_state = -2;
+
+  struct DfaState {
+    std::vector<int> nfa_states; // sorted
+    bool is_accepting = false;   // if string ends here
+    std::array<int, 128> ascii_transitions;
+    std::unordered_map<wchar_t, int> other_transitions;
+  };
+
+  class Parser;
+  class Compiler;
+
+  // Every state is added to the set at most once between calls of this function
+  void start_new_set() const;
+  // Adds `state` and everything reachable from it without consuming characters,
+  // `$` states are kept in the list unless it's the end of the string
+  void add_with_closure(std::vector<int> &list, int state, bool is_begin, bool is_end) const;
+  bool has_match(const std::vector<int> &nfa_states, bool is_begin) const;
+  // both return dead_dfa_state for empty set of NFA states and nullopt if DFA grew too big
+  std::optional<int> dfa_state_for(std::vector<int> nfa_states) const;
+  std::optional<int> dfa_transition(int dfa_state, wchar_t c) const;
+  bool full_match_by_nfa(std::wstring_view str) const;
+
+private:
+  Traits m_traits;
+  std::vector<CharSet> m_char_sets;
+  std::vector<State> m_states;
+  int m_start = -1;
+
+  mutable std::vector<DfaState> m_dfa_states;
+  mutable std::map<std::vector<int>, int> m_dfa_state_indices;
+  mutable std::optional<int> m_dfa_start;
+  // scratch buffers for closure calculation
+  mutable std::vector<int> m_stack;
+  mutable std::vector<size_t> m_marks;
+  mutable size_t m_generation = 0;
+};
@@ -14,14 +14,193 @@
 
 #pragma once
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Non-decreasing sequence of offsets stored as runs of consecutive elements where offset grows by the same step.
+// Text in single byte encoding is a single run this way and UTF-8 text gets a run per change of character size,
+// instead of an offset per character.
+template <typename IndexType> class RunLengthMapping {
+  // lookups mostly go forward through the text, so this many runs after the last used one are checked before binary search
+  static constexpr size_t max_forward_scan = 8;
+
+  struct Run {
+    IndexType index;    // of the first element of the run
+    IndexType original; // value of the first element
+    IndexType step;     // difference between consecutive elements, doesn't matter while the run has one element
+  };
+
+public:
+  // Run used by the last lookup, lookups mostly go forward through the text so it's checked first.
+  // Kept by the caller, so concurrent lookups in the same mapping are safe
+  class Hint {
+    size_t run = 0;
+    friend class RunLengthMapping;
+  };
+
+  static RunLengthMapping identity(IndexType size) {
+    RunLengthMapping mapping;
+    if (size > 0) {
+      mapping.m_runs.push_back({0, 0, 1});
+      mapping.m_size = size;
+    }
+    return mapping;
+  }
+
+  bool empty() const { return m_size == 0; }
+  IndexType size() const { return m_size; }
+  size_t run_count() const { return m_runs.size(); }
+
+  IndexType operator[](IndexType index) const {
+    Hint hint;
+    return at(index, hint);
+  }
+
+  IndexType at(IndexType index, Hint &hint) const {
+    auto &run = m_runs[run_containing(index, hint)];
+    return run.original + (index - run.index) * run.step;
+  }
+
+  IndexType front() const { return (*this)[0]; }
+  IndexType back() const { return (*this)[m_size - 1]; }
+
+  void push_back(IndexType original) {
+    if (!m_runs.empty()) {
+      auto &last = m_runs.back();
+      const auto step = original - (last.original + (m_size - 1 - last.index) * last.step);
+      if (step > 0 && (last.step == step || m_size - last.index == 1)) {
+        last.step = step;
+        ++m_size;
+        return;
+      }
+    }
+    m_runs.push_back({m_size, original, 0});
+    ++m_size;
+  }
+
+  // Appends `count` elements starting with `original` and growing by positive `step`
+  void push_back_run(IndexType original, IndexType count, IndexType step) {
+    if (count <= 0)
+      return;
+    push_back(original);
+    if (count == 1)
+      return;
+    auto &last = m_runs.back();
+    if (m_size - last.index == 1 || last.step == step)
+      last.step = step;
+    else
+      m_runs.push_back({m_size, original + step, step});
+    m_size += count - 1;
+  }
+
+  // Same as std::lower_bound over all elements, i.e. index of the first element not less than `original`
+  IndexType lower_bound(IndexType original) const {
+    Hint hint;
+    return lower_bound(original, hint);
+  }
+
+  IndexType lower_bound(IndexType original, Hint &hint) const {
+    const auto run_index = first_run_reaching(original, hint);
+    if (run_index == m_runs.size())
+      return m_size;
+    auto &run = m_runs[run_index];
+    if (original <= run.original)
+      return run.index;
+    // run has at least two elements here, so step is positive
+    return run.index + (original - run.original + run.step - 1) / run.step;
+  }
+
+  void add_offset(IndexType offset) {
+    for (auto &run : m_runs)
+      run.original += offset;
+  }
+
+  // Keeps only the first `size` elements
+  void truncate(IndexType size) {
+    if (size >= m_size)
+      return;
+    while (!m_runs.empty() && m_runs.back().index >= size)
+      m_runs.pop_back();
+    m_size = size;
+  }
+
+  // Elements [from, to) as a separate mapping
+  RunLengthMapping slice(IndexType from, IndexType to) const {
+    RunLengthMapping result;
+    if (from >= to)
+      return result;
+    auto it = std::prev(std::upper_bound(m_runs.begin(), m_runs.end(), from, [](IndexType value, const Run &run) { return value < run.index; }));
+    for (; it != m_runs.end() && it->index < to; ++it) {
+      const auto begin = std::max(it->index, from);
+      result.m_runs.push_back({begin - from, it->original + (begin - it->index) * it->step, it->step});
+    }
+    result.m_size = to - from;
+    return result;
+  }
+
+  void append(const RunLengthMapping &other) {
+    for (auto &run : other.m_runs)
+      m_runs.push_back({run.index + m_size, run.original, run.step});
+    m_size += other.m_size;
+  }
+
+private:
+  size_t run_containing(IndexType index, Hint &hint) const {
+    if (hint.run < m_runs.size() && m_runs[hint.run].index <= index) {
+      for (size_t i = hint.run; i < std::min(hint.run + max_forward_scan, m_runs.size()); ++i)
+        if (run_end(i) > index)
+          return hint.run = i;
+    }
+    auto it = std::upper_bound(m_runs.begin(), m_runs.end(), index, [](IndexType value, const Run &run) { return value < run.index; });
+    return hint.run = static_cast<size_t>(std::prev(it) - m_runs.begin());
+  }
+
+  // Index of the first run with the last element not less than `original`
+  size_t first_run_reaching(IndexType original, Hint &hint) const {
+    auto reaches = [&](size_t run_index) { return last_original(run_index) >= original; };
+    if (hint.run < m_runs.size() && (hint.run == 0 || !reaches(hint.run - 1))) {
+      for (size_t i = hint.run; i < std::min(hint.run + max_forward_scan, m_runs.size()); ++i)
+        if (reaches(i))
+          return hint.run = i;
+    }
+    size_t first = 0;
+    size_t count = m_runs.size();
+    while (count > 0) {
+      const auto half = count / 2;
+      if (!reaches(first + half)) {
+        first += half + 1;
+        count -= half + 1;
+      } else
+        count = half;
+    }
+    if (first < m_runs.size())
+      hint.run = first;
+    return first;
+  }
+
+  IndexType run_end(size_t run_index) const { return run_index + 1 < m_runs.size() ? m_runs[run_index + 1].index : m_size; }
+
+  IndexType last_original(size_t run_index) const {
+    auto &run = m_runs[run_index];
+    return run.original + (run_end(run_index) - 1 - run.index) * run.step;
+  }
+
+private:
+  std::vector<Run> m_runs;
+  IndexType m_size = 0;
+};
+
 template <typename IndexType>
 class MappedWstringGeneric {
 public:
+  using Hint = typename RunLengthMapping<IndexType>::Hint;
+
   IndexType to_original_index(IndexType cur_index) const { return !mapping.empty() ? mapping[cur_index] : cur_index; }
+  // Faster for consecutive calls going forward with the same `hint`
+  IndexType to_original_index(IndexType cur_index, Hint &hint) const { return !mapping.empty() ? mapping.at(cur_index, hint) : cur_index; }
 
-  IndexType from_original_index(IndexType cur_index) const {
-    return !mapping.empty() ? static_cast<IndexType>(std::lower_bound(mapping.begin(), mapping.end(), cur_index) - mapping.begin()) : cur_index;
-  }
+  IndexType from_original_index(IndexType cur_index) const { return !mapping.empty() ? mapping.lower_bound(cur_index) : cur_index; }
 
   IndexType original_length() const { return !mapping.empty() ? mapping.back() : static_cast<IndexType>(str.size()); }
 
@@ -29,11 +208,11 @@ public:
     if (!str.empty() && !other.str.empty())
       str.push_back(L'\n');
     str.insert(str.end(), other.str.begin(), other.str.end());
-    mapping.insert(mapping.end(), other.mapping.begin(), other.mapping.end());
+    mapping.append(other.mapping);
   }
 
 public:
   std::wstring str;
-  std::vector<IndexType> mapping; // should have size str.length () or empty (if empty mapping is identity a<->a)
+  RunLengthMapping<IndexType> mapping; // should have size str.length () + 1 or be empty (if empty mapping is identity a<->a)
   // indices should correspond to offsets string `str` had in original encoding
 };
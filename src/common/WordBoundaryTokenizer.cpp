@@ -0,0 +1,392 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "WordBoundaryTokenizer.h"
+
+#include "WordBreakData.h"
+
+#include <algorithm>
+
+namespace {
+using enum WordBreakProperty;
+
+constexpr char32_t code_point_count = 0x110000;
+// Code points are split into blocks, each block refers to a row of properties. Rows of blocks having a single property are shared.
+constexpr char32_t block_size = 128;
+constexpr size_t block_count = code_point_count / block_size;
+constexpr size_t property_count = static_cast<size_t>(WordBreakProperty::COUNT);
+constexpr size_t range_count = std::size(word_break_data::ranges);
+
+// Calls `callback(block_index, first_range)` for every block containing several properties,
+// `first_range` is index of the first range intersecting with the block.
+// Other blocks are passed to `uniform_callback(block_index, property)`.
+template <typename MixedCallback, typename UniformCallback>
+constexpr void for_each_block(const MixedCallback &callback, const UniformCallback &uniform_callback) {
+  size_t range = 0;
+  for (size_t block = 0; block < block_count; ++block) {
+    const auto first = static_cast<char32_t>(block * block_size);
+    const char32_t last = first + block_size - 1;
+    while (range < range_count && word_break_data::ranges[range].last < first)
+      ++range;
+    if (range == range_count || word_break_data::ranges[range].first > last)
+      uniform_callback(block, other);
+    // neighbour ranges always have different properties so a single range should cover the whole block
+    else if (word_break_data::ranges[range].first <= first && word_break_data::ranges[range].last >= last)
+      uniform_callback(block, word_break_data::ranges[range].property);
+    else
+      callback(block, range);
+  }
+}
+
+constexpr size_t count_mixed_blocks() {
+  size_t count = 0;
+  for_each_block([&](size_t, size_t) { ++count; }, [](size_t, WordBreakProperty) {});
+  return count;
+}
+
+constexpr size_t row_count = property_count + count_mixed_blocks();
+static_assert(row_count <= 0x100, "row indices are stored in bytes");
+
+struct WordBreakTables {
+  std::array<uint8_t, block_count> block_rows = {};
+  std::array<std::array<WordBreakProperty, block_size>, row_count> rows = {};
+};
+
+constexpr WordBreakTables build_tables() {
+  WordBreakTables tables;
+  // first rows are uniform ones in the order of properties
+  for (size_t property = 0; property < property_count; ++property)
+    tables.rows[property].fill(static_cast<WordBreakProperty>(property));
+  size_t next_row = property_count;
+  for_each_block(
+    [&](size_t block, size_t range) {
+      const auto first = static_cast<char32_t>(block * block_size);
+      const char32_t last = first + block_size - 1;
+      auto &row = tables.rows[next_row];
+      tables.block_rows[block] = static_cast<uint8_t>(next_row++);
+      for (; range < range_count && word_break_data::ranges[range].first <= last; ++range) {
+        const auto &r = word_break_data::ranges[range];
+        for (auto c = std::max(r.first, first); c <= std::min(r.last, last); ++c)
+          row[c - first] = r.property;
+      }
+    },
+    [&](size_t block, WordBreakProperty property) { tables.block_rows[block] = static_cast<uint8_t>(property); });
+  return tables;
+}
+
+constexpr WordBreakTables tables = build_tables();
+
+WordBreakProperty lookup(char32_t c) {
+  if (c >= code_point_count)
+    return other;
+  return tables.rows[tables.block_rows[c / block_size]][c % block_size];
+}
+
+bool is_high_surrogate(wchar_t c) { return c >= 0xD800 && c <= 0xDBFF; }
+bool is_low_surrogate(wchar_t c) { return c >= 0xDC00 && c <= 0xDFFF; }
+char32_t surrogate_pair_to_code_point(wchar_t high, wchar_t low) {
+  return 0x10000 + ((static_cast<char32_t>(high) - 0xD800) << 10) + (static_cast<char32_t>(low) - 0xDC00);
+}
+
+constexpr bool is_line_break(WordBreakProperty property) { return property == cr || property == lf || property == newline; }
+constexpr bool is_ignorable(WordBreakProperty property) { return property == extend || property == format || property == zwj; }
+constexpr bool is_ah_letter(WordBreakProperty property) { return property == a_letter || property == hebrew_letter; }
+constexpr bool is_mid_letter_q(WordBreakProperty property) { return property == mid_letter || property == mid_num_let || property == single_quote; }
+constexpr bool is_mid_num_q(WordBreakProperty property) { return property == mid_num || property == mid_num_let || property == single_quote; }
+constexpr bool is_word_character(WordBreakProperty property) { return is_ah_letter(property) || property == numeric || property == katakana; }
+
+// Tells if WB4 or any of rules looking beyond adjacent characters (WB6 - WB7c, WB11, WB12, WB15, WB16) could apply
+constexpr bool depends_on_context(WordBreakProperty before, WordBreakProperty after) {
+  return is_ignorable(before) || (is_ah_letter(before) && is_mid_letter_q(after)) || (is_mid_letter_q(before) && is_ah_letter(after)) ||
+         (before == hebrew_letter && after == double_quote) || (before == double_quote && after == hebrew_letter) ||
+         (before == numeric && is_mid_num_q(after)) || (is_mid_num_q(before) && after == numeric) ||
+         (before == regional_indicator && after == regional_indicator);
+}
+
+// WB3 - WB4, they take only adjacent characters into account
+constexpr std::optional<bool> adjacent_rules(WordBreakProperty before, WordBreakProperty after) {
+  if (before == cr && after == lf)
+    return false;
+  if (is_line_break(before) || is_line_break(after))
+    return true;
+  if (before == zwj && after == extended_pictographic)
+    return false;
+  if (before == w_seg_space && after == w_seg_space)
+    return false;
+  if (is_ignorable(after))
+    return false;
+  return std::nullopt;
+}
+
+// WB5, WB8 - WB10, WB13 - WB13b and WB999 for characters which are adjacent after WB4
+constexpr bool is_boundary_between(WordBreakProperty left, WordBreakProperty right) {
+  if ((is_ah_letter(left) || left == numeric) && (is_ah_letter(right) || right == numeric))
+    return false;
+  if (left == katakana && right == katakana)
+    return false;
+  if ((is_word_character(left) || left == extend_num_let) && right == extend_num_let)
+    return false;
+  if (left == extend_num_let && is_word_character(right))
+    return false;
+  return true;
+}
+
+enum class AdjacentBoundary : uint8_t {
+  no,
+  yes,
+  depends_on_context,
+};
+
+// Decisions for every pair of adjacent characters, most of them don't need to look any further
+constexpr auto adjacent_boundaries = [] {
+  std::array<std::array<AdjacentBoundary, property_count>, property_count> result = {};
+  for (size_t before = 0; before < property_count; ++before)
+    for (size_t after = 0; after < property_count; ++after) {
+      const auto b = static_cast<WordBreakProperty>(before), a = static_cast<WordBreakProperty>(after);
+      auto boundary = adjacent_rules(b, a);
+      if (!boundary && !depends_on_context(b, a))
+        boundary = is_boundary_between(b, a);
+      result[before][after] = boundary ? (*boundary ? AdjacentBoundary::yes : AdjacentBoundary::no) : AdjacentBoundary::depends_on_context;
+    }
+  return result;
+}();
+} // namespace
+
+WordBreakProperty word_break_property(char32_t c) { return lookup(c); }
+
+WordBoundaryTokenizer::WordBoundaryTokenizer(std::wstring_view target, bool split_camel_case)
+  : m_target(target), m_split_camel_case(split_camel_case) {
+}
+
+std::vector<std::wstring_view> WordBoundaryTokenizer::get_all_tokens() const {
+  const auto length = static_cast<TextPosition>(m_target.length());
+  std::vector<std::wstring_view> ret;
+  TextPosition segment_begin = 0;
+  bool is_word = false;
+  auto before = other;
+  for (TextPosition i = 0; i < length;) {
+    const auto c = m_target[i];
+    // lookup is inlined here for the common case of characters from BMP
+    const bool is_surrogate_pair = is_high_surrogate(c) && i + 1 < length && is_low_surrogate(m_target[i + 1]);
+    const auto next = i + (is_surrogate_pair ? 2 : 1);
+    const auto after = is_surrogate_pair ? property_at(i) : lookup(static_cast<char32_t>(c));
+    if (i > 0 && is_boundary(i, before, after)) {
+      if (is_word)
+        push_tokens(ret, segment_begin, i);
+      segment_begin = i;
+      is_word = false;
+    }
+    is_word = is_word || is_word_character(after);
+    before = after;
+    i = next;
+  }
+  if (is_word)
+    push_tokens(ret, segment_begin, length);
+  return ret;
+}
+
+TextPosition WordBoundaryTokenizer::prev_token_begin(TextPosition index) const {
+  if (index <= 0)
+    return 0;
+  const auto length = static_cast<TextPosition>(m_target.length());
+  index = std::min(index, length);
+  if (index < length) {
+    if (auto token = token_containing(index))
+      return (*token)[0];
+  }
+  if (auto token = token_containing(index - 1); token && (*token)[1] == index)
+    return (*token)[0];
+  return index;
+}
+
+TextPosition WordBoundaryTokenizer::next_token_end(TextPosition index) const {
+  const auto length = static_cast<TextPosition>(m_target.length());
+  if (index >= length)
+    return length;
+  if (auto token = token_containing(std::max(index, TextPosition{0})))
+    return (*token)[1];
+  return index;
+}
+
+std::optional<std::array<TextPosition, 2>> WordBoundaryTokenizer::token_starting_from(TextPosition position) const {
+  const auto length = static_cast<TextPosition>(m_target.length());
+  while (position < length) {
+    auto [segment_begin, segment_end] = segment_at(position);
+    if (is_word_segment(segment_begin, segment_end)) {
+      auto end = position + 1;
+      while (end < segment_end && !is_camel_case_split(end, segment_begin, segment_end))
+        ++end;
+      return std::array{position, end};
+    }
+    position = segment_end;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::array<TextPosition, 2>> WordBoundaryTokenizer::token_ending_before(TextPosition position) const {
+  while (position > 0) {
+    auto [segment_begin, segment_end] = segment_at(position - 1);
+    if (is_word_segment(segment_begin, segment_end)) {
+      auto begin = position - 1;
+      while (begin > segment_begin && !is_camel_case_split(begin, segment_begin, segment_end))
+        --begin;
+      return std::array{begin, position};
+    }
+    position = segment_begin;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::array<TextPosition, 2>> WordBoundaryTokenizer::token_containing(TextPosition position) const {
+  auto [segment_begin, segment_end] = segment_at(position);
+  if (!is_word_segment(segment_begin, segment_end))
+    return std::nullopt;
+  auto begin = position;
+  while (begin > segment_begin && !is_camel_case_split(begin, segment_begin, segment_end))
+    --begin;
+  auto end = position + 1;
+  while (end < segment_end && !is_camel_case_split(end, segment_begin, segment_end))
+    ++end;
+  return std::array{begin, end};
+}
+
+void WordBoundaryTokenizer::push_tokens(std::vector<std::wstring_view> &tokens, TextPosition segment_begin, TextPosition segment_end) const {
+  auto begin = segment_begin;
+  if (m_split_camel_case) {
+    for (auto i = segment_begin + 1; i < segment_end; ++i) {
+      if (is_camel_case_split(i, segment_begin, segment_end)) {
+        tokens.push_back(m_target.substr(begin, i - begin));
+        begin = i;
+      }
+    }
+  }
+  tokens.push_back(m_target.substr(begin, segment_end - begin));
+}
+
+bool WordBoundaryTokenizer::is_camel_case_split(TextPosition index, TextPosition segment_begin, TextPosition segment_end) const {
+  return m_split_camel_case && index > segment_begin && index < segment_end && is_upper(m_target[index]) &&
+         (is_lower(m_target[index - 1]) || (index + 1 < segment_end && is_lower(m_target[index + 1])));
+}
+
+std::array<TextPosition, 2> WordBoundaryTokenizer::segment_at(TextPosition position) const {
+  auto begin = position;
+  while (!is_boundary(begin))
+    --begin;
+  auto end = position + 1;
+  while (!is_boundary(end))
+    ++end;
+  return {begin, end};
+}
+
+bool WordBoundaryTokenizer::is_word_segment(TextPosition begin, TextPosition end) const {
+  for (auto i = begin; i < end; i = next_char_start(i))
+    if (is_word_character(property_at(i)))
+      return true;
+  return false;
+}
+
+bool WordBoundaryTokenizer::is_boundary(TextPosition position) const {
+  if (position <= 0 || position >= static_cast<TextPosition>(m_target.length()))
+    return true; // WB1, WB2
+  if (is_low_surrogate(m_target[position]) && is_high_surrogate(m_target[position - 1]))
+    return false;
+  return is_boundary(position, property_at(prev_char_start(position)), property_at(position));
+}
+
+bool WordBoundaryTokenizer::is_boundary(TextPosition position, WordBreakProperty before, WordBreakProperty after) const {
+  const auto adjacent = adjacent_boundaries[static_cast<size_t>(before)][static_cast<size_t>(after)];
+  if (adjacent != AdjacentBoundary::depends_on_context)
+    return adjacent == AdjacentBoundary::yes;
+  return is_boundary_in_context(position, after);
+}
+
+bool WordBoundaryTokenizer::is_boundary_in_context(TextPosition position, WordBreakProperty after) const {
+  TextPosition left_start = 0;
+  const auto left = effective_property_before(position, &left_start);
+  if (is_ah_letter(left) && is_mid_letter_q(after) && is_ah_letter(effective_property_after(position)))
+    return false; // WB6
+  if (is_mid_letter_q(left) && is_ah_letter(after) && is_ah_letter(effective_property_before(left_start)))
+    return false; // WB7
+  if (left == hebrew_letter && after == single_quote)
+    return false; // WB7a
+  if (left == hebrew_letter && after == double_quote && effective_property_after(position) == hebrew_letter)
+    return false; // WB7b
+  if (left == double_quote && after == hebrew_letter && effective_property_before(left_start) == hebrew_letter)
+    return false; // WB7c
+  if (is_mid_num_q(left) && after == numeric && effective_property_before(left_start) == numeric)
+    return false; // WB11
+  if (left == numeric && is_mid_num_q(after) && effective_property_after(position) == numeric)
+    return false; // WB12
+  if (left == regional_indicator && after == regional_indicator)
+    return regional_indicators_before(position) % 2 == 0; // WB15, WB16
+  return is_boundary_between(left, after);
+}
+
+WordBreakProperty WordBoundaryTokenizer::effective_property_before(TextPosition position, TextPosition *start) const {
+  if (position <= 0)
+    return other;
+  auto result_start = prev_char_start(position);
+  auto result = property_at(result_start);
+  // sequence of ignorable characters after line break or at the start of text isn't attached to anything
+  while (is_ignorable(result) && result_start > 0) {
+    const auto prev_start = prev_char_start(result_start);
+    const auto prev = property_at(prev_start);
+    if (is_line_break(prev))
+      break;
+    result_start = prev_start;
+    result = prev;
+  }
+  if (start)
+    *start = result_start;
+  return result;
+}
+
+WordBreakProperty WordBoundaryTokenizer::effective_property_after(TextPosition position) const {
+  const auto length = static_cast<TextPosition>(m_target.length());
+  for (auto i = next_char_start(position); i < length; i = next_char_start(i)) {
+    const auto property = property_at(i);
+    if (!is_ignorable(property))
+      return property;
+  }
+  return other;
+}
+
+int WordBoundaryTokenizer::regional_indicators_before(TextPosition position) const {
+  int count = 0;
+  TextPosition start = 0;
+  while (position > 0 && effective_property_before(position, &start) == regional_indicator) {
+    ++count;
+    position = start;
+  }
+  return count;
+}
+
+TextPosition WordBoundaryTokenizer::prev_char_start(TextPosition position) const {
+  if (position >= 2 && is_low_surrogate(m_target[position - 1]) && is_high_surrogate(m_target[position - 2]))
+    return position - 2;
+  return position - 1;
+}
+
+TextPosition WordBoundaryTokenizer::next_char_start(TextPosition position) const {
+  if (is_high_surrogate(m_target[position]) && position + 1 < static_cast<TextPosition>(m_target.length()) && is_low_surrogate(m_target[position + 1]))
+    return position + 2;
+  return position + 1;
+}
+
+WordBreakProperty WordBoundaryTokenizer::property_at(TextPosition position) const {
+  const auto c = m_target[position];
+  if (is_high_surrogate(c) && position + 1 < static_cast<TextPosition>(m_target.length()) && is_low_surrogate(m_target[position + 1]))
+    return lookup(surrogate_pair_to_code_point(c, m_target[position + 1]));
+  return lookup(static_cast<char32_t>(c));
+}
@@ -0,0 +1,111 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "string_utils.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+// Word_Break property values of Unicode Standard Annex #29,
+// extended_pictographic is used only for characters which have no other value (it matters only for rule WB3c)
+enum class WordBreakProperty : uint8_t {
+  other,
+  cr,
+  lf,
+  newline,
+  extend,
+  zwj,
+  regional_indicator,
+  format,
+  katakana,
+  hebrew_letter,
+  a_letter,
+  single_quote,
+  double_quote,
+  mid_num_let,
+  mid_letter,
+  mid_num,
+  numeric,
+  extend_num_let,
+  w_seg_space,
+  extended_pictographic,
+
+  // ReSharper disable once CppInconsistentNaming
+  COUNT,
+};
+
+struct WordBreakRange {
+  char32_t first;
+  char32_t last;
+  WordBreakProperty property;
+};
+
+// Looks the property up in two-stage table built at compile time from WordBreakData.h
+WordBreakProperty word_break_property(char32_t c);
+
+// Splits text by default word boundaries of Unicode Standard Annex #29. Only segments containing letters, digits or katakana are tokens,
+// so apostrophes and periods inside of words ("don't", "e.g.") and numbers like "3.14" stay whole without any delimiter exclusions.
+// Has the same interface and the same meaning of positions as Tokenizer so they're interchangeable in Settings::do_with_tokenizer().
+class WordBoundaryTokenizer {
+public:
+  WordBoundaryTokenizer(std::wstring_view target, bool split_camel_case);
+
+  std::vector<std::wstring_view> get_all_tokens() const;
+  // Lazily yield the same tokens as get_all_tokens(), iterators refer to the tokenizer so it should outlive them
+  auto tokens() const { return std::ranges::subrange(TokenIterator<WordBoundaryTokenizer, false>(*this, 0), std::default_sentinel); }
+  auto reversed_tokens() const {
+    return std::ranges::subrange(TokenIterator<WordBoundaryTokenizer, true>(*this, static_cast<TextPosition>(m_target.length())), std::default_sentinel);
+  }
+
+  TextPosition prev_token_begin(TextPosition index) const;
+  TextPosition next_token_end(TextPosition index) const;
+
+private:
+  template <typename, bool> friend class TokenIterator;
+
+  std::optional<std::array<TextPosition, 2>> token_starting_from(TextPosition position) const;
+  std::optional<std::array<TextPosition, 2>> token_ending_before(TextPosition position) const;
+  // Token (or its camel case part) containing code unit at `position`
+  std::optional<std::array<TextPosition, 2>> token_containing(TextPosition position) const;
+  void push_tokens(std::vector<std::wstring_view> &tokens, TextPosition segment_begin, TextPosition segment_end) const;
+  bool is_camel_case_split(TextPosition index, TextPosition segment_begin, TextPosition segment_end) const;
+
+  // Bounds of the segment containing code unit at `position`
+  std::array<TextPosition, 2> segment_at(TextPosition position) const;
+  bool is_word_segment(TextPosition begin, TextPosition end) const;
+  bool is_boundary(TextPosition position) const;
+  // `before` and `after` are properties of characters adjacent to `position`
+  bool is_boundary(TextPosition position, WordBreakProperty before, WordBreakProperty after) const;
+  // WB4 and rules after it which look beyond adjacent characters
+  bool is_boundary_in_context(TextPosition position, WordBreakProperty after) const;
+  // Property of the character preceding `position` after Extend, Format and ZWJ are attached to the characters before them (WB4),
+  // `start` is set to its position. Returns `other` at the start of text.
+  WordBreakProperty effective_property_before(TextPosition position, TextPosition *start = nullptr) const;
+  // Property of the first character after the one at `position` which isn't Extend, Format or ZWJ, `other` at the end of text
+  WordBreakProperty effective_property_after(TextPosition position) const;
+  int regional_indicators_before(TextPosition position) const;
+
+  TextPosition prev_char_start(TextPosition position) const;
+  TextPosition next_char_start(TextPosition position) const;
+  WordBreakProperty property_at(TextPosition position) const;
+
+private:
+  std::wstring_view m_target;
+  bool m_split_camel_case;
+};
@@ -56,12 +56,12 @@ size_t find_case_insensitive(const std::string_view &str_haystack, const std::st
 string_case_type get_string_case_type(const std::wstring_view &sv) {
   if (sv.empty())
     return string_case_type::mixed;
-  size_t lower_count = std::count_if(sv.begin(), sv.end(), &IsCharLower);
+  size_t lower_count = std::count_if(sv.begin(), sv.end(), &is_lower);
   if (lower_count == 0)
     return string_case_type::upper;
   if (lower_count == sv.length())
     return string_case_type::lower;
-  if (lower_count == sv.length() - 1 && IsCharUpper(sv.front()))
+  if (lower_count == sv.length() - 1 && is_upper(sv.front()))
     return string_case_type::title;
 
   return string_case_type::mixed;
@@ -87,19 +87,3 @@ void apply_case_type(std::wstring &str, string_case_type type) {
   if (type == string_case_type::title)
     str.front() = make_upper(str.front());
 }
-
-wchar_t make_upper(wchar_t c) {
-  return static_cast<wchar_t>(reinterpret_cast<std::size_t>(CharUpper(reinterpret_cast<LPWSTR>(c))));
-}
-
-wchar_t make_lower(wchar_t c) {
-  return static_cast<wchar_t>(reinterpret_cast<std::size_t>(CharLower(reinterpret_cast<LPWSTR>(c))));
-}
-
-bool is_upper(wchar_t c) {
-  return IsCharUpper(c);
-}
-
-bool is_lower(wchar_t c) {
-  return IsCharLower(c);
-}
@@ -14,13 +14,67 @@
 
 #pragma once
 
+#include "AsciiTokenScanner.h"
 #include "plugin/Constants.h"
 
+#include <bit>
+#include <bitset>
+#include <functional>
+#include <ranges>
+
 wchar_t make_upper(wchar_t c);
 wchar_t make_lower(wchar_t c);
 bool is_upper(wchar_t c);
 bool is_lower(wchar_t c);
 
+class DelimiterTable;
+
+namespace detail {
+// Only delimiter table knows its ASCII ranges, other predicates are checked character by character
+template <typename IsDelimiterType> const AsciiDelimiterRanges *ascii_delimiter_ranges(const IsDelimiterType &) { return nullptr; }
+inline const AsciiDelimiterRanges *ascii_delimiter_ranges(const DelimiterTable &table);
+inline const AsciiDelimiterRanges *ascii_delimiter_ranges(const std::reference_wrapper<const DelimiterTable> &table);
+} // namespace detail
+
+// Lazily yields tokens of `TokenizerType` one by one, from the end of the text if `reversed` is true.
+// Tokenizer provides them by token_starting_from() and token_ending_before() returning token bounds or nullopt if there are no more tokens.
+template <typename TokenizerType, bool reversed> class TokenIterator {
+public:
+  using value_type = std::wstring_view;
+  using difference_type = std::ptrdiff_t;
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+
+  TokenIterator() = default;
+  TokenIterator(const TokenizerType &tokenizer, TextPosition position) : m_tokenizer(&tokenizer), m_position(position) { ++*this; }
+
+  std::wstring_view operator*() const { return m_token; }
+  TokenIterator &operator++() {
+    auto token = reversed ? m_tokenizer->token_ending_before(m_position) : m_tokenizer->token_starting_from(m_position);
+    if (!token) {
+      m_tokenizer = nullptr;
+      m_token = {};
+      return *this;
+    }
+    auto [begin, end] = *token;
+    m_token = m_tokenizer->m_target.substr(begin, end - begin);
+    m_position = reversed ? begin : end;
+    return *this;
+  }
+  TokenIterator operator++(int) {
+    auto copy = *this;
+    ++*this;
+    return copy;
+  }
+  bool operator==(const TokenIterator &other) const { return m_tokenizer == other.m_tokenizer && m_token.data() == other.m_token.data(); }
+  bool operator==(std::default_sentinel_t) const { return m_tokenizer == nullptr; }
+
+private:
+  const TokenizerType *m_tokenizer = nullptr;
+  TextPosition m_position = 0;
+  std::wstring_view m_token;
+};
+
 template <typename IsDelimiterType> class Tokenizer {
 public:
   Tokenizer(const std::wstring_view &target, const IsDelimiterType &is_delimiter, bool split_camel_case)
@@ -28,6 +82,9 @@ public:
   }
 
   std::vector<std::wstring_view> get_all_tokens() const {
+    if (auto ranges = detail::ascii_delimiter_ranges(m_is_delimiter))
+      return get_all_tokens_vectorized(*ranges);
+
     int token_begin = 0, token_end = -1;
     std::vector<std::wstring_view> ret;
 
@@ -56,6 +113,12 @@ public:
     return ret;
   }
 
+  // Lazily yield the same tokens as get_all_tokens(), iterators refer to the tokenizer so it should outlive them
+  auto tokens() const { return std::ranges::subrange(TokenIterator<Tokenizer, false>(*this, 0), std::default_sentinel); }
+  auto reversed_tokens() const {
+    return std::ranges::subrange(TokenIterator<Tokenizer, true>(*this, static_cast<TextPosition>(m_target.length())), std::default_sentinel);
+  }
+
   TextPosition prev_token_begin(TextPosition index) const {
     if (index <= 0)
       return 0;
@@ -88,12 +151,138 @@ public:
     return index;
   }
 
+private:
+  template <typename, bool> friend class TokenIterator;
+
+  // Tells if get_all_tokens() splits camel case token between `index - 1` and `index`
+  bool is_camel_case_split(TextPosition index) const {
+    const auto length = static_cast<TextPosition>(m_target.length());
+    return m_split_camel_case && index > 0 && index < length && !m_is_delimiter(m_target[index - 1]) && !m_is_delimiter(m_target[index]) &&
+           is_upper(m_target[index]) && (is_lower(m_target[index - 1]) || (index < length - 1 && is_lower(m_target[index + 1])));
+  }
+
+  std::optional<std::array<TextPosition, 2>> token_starting_from(TextPosition position) const {
+    const auto length = static_cast<TextPosition>(m_target.length());
+    while (position < length && m_is_delimiter(m_target[position]))
+      ++position;
+    if (position == length)
+      return std::nullopt;
+    auto end = position + 1;
+    while (end < length && !m_is_delimiter(m_target[end]) && !is_camel_case_split(end))
+      ++end;
+    return std::array{position, end};
+  }
+
+  std::optional<std::array<TextPosition, 2>> token_ending_before(TextPosition position) const {
+    while (position > 0 && m_is_delimiter(m_target[position - 1]))
+      --position;
+    if (position == 0)
+      return std::nullopt;
+    auto begin = position - 1;
+    while (begin > 0 && !m_is_delimiter(m_target[begin - 1]) && !is_camel_case_split(begin))
+      --begin;
+    return std::array{begin, position};
+  }
+
+  // Same result as scalar version but whole blocks of ASCII text are classified at once and their token boundaries are found by bit operations
+  std::vector<std::wstring_view> get_all_tokens_vectorized(const AsciiDelimiterRanges &ranges) const {
+    constexpr auto block_size = AsciiDelimiterRanges::block_size;
+    constexpr uint32_t block_mask = (1u << block_size) - 1;
+    const auto length = static_cast<TextPosition>(m_target.length());
+    std::vector<std::wstring_view> ret;
+    // -1 means that previous character is a delimiter (or there's none)
+    TextPosition token_begin = -1;
+    auto push_token = [&](TextPosition token_end) { ret.push_back(m_target.substr(token_begin, token_end - token_begin)); };
+
+    auto process_character = [&](TextPosition i) {
+      const auto c = m_target[i];
+      if (m_is_delimiter(c)) {
+        if (token_begin >= 0) {
+          push_token(i);
+          token_begin = -1;
+        }
+      } else if (token_begin < 0)
+        token_begin = i;
+      else if (m_split_camel_case && is_upper(c) && (is_lower(m_target[i - 1]) || (i < length - 1 && is_lower(m_target[i + 1])))) {
+        push_token(i);
+        token_begin = i;
+      }
+    };
+
+    AsciiBlockClasses classes;
+    TextPosition i = 0;
+    while (i < length) {
+      const auto block_end = i + block_size;
+      if (block_end > length || !ranges.classify_block(m_target.data() + i, classes)) {
+        for (const auto scalar_end = std::min(block_end, length); i < scalar_end; ++i)
+          process_character(i);
+        continue;
+      }
+
+      const uint32_t delimiter_before_block = token_begin < 0 ? 1 : 0;
+      const auto non_delimiters = ~classes.delimiters & block_mask;
+      const auto after_delimiter = ((classes.delimiters << 1) | delimiter_before_block) & block_mask;
+      const auto token_begins = non_delimiters & after_delimiter;
+      const auto token_ends = classes.delimiters & ~after_delimiter;
+      uint32_t camel_case_splits = 0;
+      if (m_split_camel_case) {
+        const uint32_t lower_before_block = i > 0 && is_lower(m_target[i - 1]) ? 1 : 0;
+        const uint32_t lower_after_block = block_end < length && is_lower(m_target[block_end]) ? 1 : 0;
+        const auto lower_before = (classes.lower << 1) | lower_before_block;
+        const auto lower_after = (classes.lower >> 1) | (lower_after_block << (block_size - 1));
+        camel_case_splits = non_delimiters & ~after_delimiter & classes.upper & (lower_before | lower_after);
+      }
+
+      for (auto events = token_begins | token_ends | camel_case_splits; events != 0; events &= events - 1) {
+        const auto bit = std::countr_zero(events);
+        const auto position = i + bit;
+        if (token_begins & (1u << bit))
+          token_begin = position;
+        else {
+          push_token(position);
+          token_begin = (camel_case_splits & (1u << bit)) != 0 ? position : -1;
+        }
+      }
+      i = block_end;
+    }
+    if (token_begin >= 0)
+      push_token(length);
+    return ret;
+  }
+
 private:
   std::wstring_view m_target;
   IsDelimiterType m_is_delimiter;
   bool m_split_camel_case;
 };
 
+// Dense table with a bit for every UTF-16 code unit telling if it's a delimiter, so classification is a single lookup
+class DelimiterTable {
+public:
+  DelimiterTable() = default;
+  template <typename IsDelimiterType> explicit DelimiterTable(const IsDelimiterType &is_delimiter) {
+    std::bitset<128> is_ascii_delimiter;
+    for (size_t c = 0; c < m_is_delimiter.size(); ++c) {
+      m_is_delimiter[c] = is_delimiter(static_cast<wchar_t>(c));
+      if (c < is_ascii_delimiter.size())
+        is_ascii_delimiter[c] = m_is_delimiter[c];
+    }
+    m_ascii_ranges = AsciiDelimiterRanges::from_ascii_delimiters(is_ascii_delimiter);
+  }
+
+  bool operator()(wchar_t c) const { return static_cast<size_t>(c) < m_is_delimiter.size() && m_is_delimiter[c]; }
+  const AsciiDelimiterRanges *ascii_ranges() const { return m_ascii_ranges ? &*m_ascii_ranges : nullptr; }
+
+private:
+  std::bitset<0x10000> m_is_delimiter;
+  std::optional<AsciiDelimiterRanges> m_ascii_ranges;
+};
+
+namespace detail {
+inline const AsciiDelimiterRanges *ascii_delimiter_ranges(const DelimiterTable &table) { return table.ascii_ranges(); }
+inline const AsciiDelimiterRanges *ascii_delimiter_ranges(const std::reference_wrapper<const DelimiterTable> &table) { return table.get().ascii_ranges(); }
+} // namespace detail
+
 inline auto make_delimiter_tokenizer(std::wstring_view target, std::wstring_view delimiters, bool split_camel_case = false) {
   return Tokenizer(target, [=](wchar_t c) { return delimiters.find(c) != std::string_view::npos; }, split_camel_case);
 }
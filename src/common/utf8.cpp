@@ -96,3 +96,30 @@ size_t utf8_length(const char *string) {
   }
   return size;
 }
+
+bool append_utf16_as_utf8(std::string &target, std::wstring_view source) {
+  for (size_t i = 0; i < source.length(); ++i) {
+    auto code_point = static_cast<char32_t>(source[i]);
+    if (code_point < 0x80) {
+      target.push_back(static_cast<char>(code_point));
+      continue;
+    }
+    if (code_point < 0x800) {
+      target.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      target.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+      continue;
+    }
+    if (code_point >= 0xD800 && code_point < 0xE000) {
+      if (code_point >= 0xDC00 || i + 1 == source.length() || source[i + 1] < 0xDC00 || source[i + 1] >= 0xE000)
+        return false;
+      code_point = 0x10000 + ((code_point - 0xD800) << 10) + (static_cast<char32_t>(source[i + 1]) - 0xDC00);
+      ++i;
+      target.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      target.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+    } else
+      target.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+    target.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+    target.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+  }
+  return true;
+}
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <string>
+#include <string_view>
+
 char *utf8_dec(const char *string, const char *current);
 char *utf8_chr(const char *s, const char *sfc);
 int utf8_symbol_len(char c);
@@ -23,3 +26,5 @@ const char *utf8_pbrk(const char *s, const char *set);
 size_t utf8_length(const char *string);
 bool utf8_is_lead(char c);
 bool utf8_is_cont(char c);
+// Appends UTF-8 form of UTF-16 `source` to `target` without going through iconv, returns false if `source` has unpaired surrogates
+bool append_utf16_as_utf8(std::string &target, std::wstring_view source);
@@ -0,0 +1,139 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "AppliedUnderlines.h"
+
+namespace {
+using Range = AppliedUnderlines::Range;
+
+bool intersects(const Range &lhs, const Range &rhs) { return lhs[0] < rhs[1] && rhs[0] < lhs[1]; }
+
+// Removes [from, to) from every range, ranges are split if needed
+void subtract(std::vector<Range> &ranges, TextPosition from, TextPosition to) {
+  std::vector<Range> result;
+  for (auto &range : ranges) {
+    if (range[0] < from)
+      result.push_back({range[0], std::min(range[1], from)});
+    if (range[1] > to)
+      result.push_back({std::max(range[0], to), range[1]});
+  }
+  ranges = std::move(result);
+}
+
+void merge(std::vector<Range> &ranges) {
+  std::ranges::sort(ranges);
+  std::vector<Range> result;
+  for (auto &range : ranges) {
+    if (!result.empty() && range[0] <= result.back()[1])
+      result.back()[1] = std::max(result.back()[1], range[1]);
+    else
+      result.push_back(range);
+  }
+  ranges = std::move(result);
+}
+} // namespace
+
+AppliedUnderlines::AppliedUnderlines(TextPosition document_length)
+  : m_document_length(document_length), m_unknown{{0, document_length}} {
+}
+
+AppliedUnderlines::Operations AppliedUnderlines::update(TextPosition from, TextPosition to, const std::vector<Range> &underlines) {
+  Operations operations;
+  Range checked{from, to};
+  for (auto &range : m_unknown)
+    if (intersects(range, checked))
+      operations.to_clear.push_back({std::max(range[0], from), std::min(range[1], to)});
+
+  std::vector<Range> outside_parts;
+  for (auto &range : m_underlines) {
+    if (!intersects(range, checked))
+      continue;
+    if (!std::ranges::binary_search(underlines, range))
+      operations.to_clear.push_back({std::max(range[0], from), std::min(range[1], to)});
+    // parts outside of checked range stay underlined but it's easier to consider them unknown
+    if (range[0] < from)
+      outside_parts.push_back({range[0], from});
+    if (range[1] > to)
+      outside_parts.push_back({to, range[1]});
+  }
+
+  for (auto &underline : underlines) {
+    bool is_applied = std::ranges::binary_search(m_underlines, underline);
+    bool is_cleared = std::ranges::any_of(operations.to_clear, [&](const Range &range) { return intersects(range, underline); });
+    if (!is_applied || is_cleared)
+      operations.to_fill.push_back(underline);
+  }
+
+  std::erase_if(m_underlines, [&](const Range &range) { return intersects(range, checked); });
+  m_underlines.insert(m_underlines.end(), underlines.begin(), underlines.end());
+  std::ranges::sort(m_underlines);
+  subtract(m_unknown, from, to);
+  m_unknown.insert(m_unknown.end(), outside_parts.begin(), outside_parts.end());
+  merge(m_unknown);
+  return operations;
+}
+
+void AppliedUnderlines::on_text_modified(TextPosition position, TextPosition length, bool is_insertion) {
+  m_document_length += is_insertion ? length : -length;
+  auto shift = [&](TextPosition pos) {
+    if (pos < position)
+      return pos;
+    if (is_insertion)
+      return pos + length;
+    return pos >= position + length ? pos - length : position;
+  };
+  // editor extends or cuts underlines touching modified text, their state is not known anymore
+  Range modified{position, is_insertion ? position + length : position};
+  auto modified_end = is_insertion ? position : position + length;
+  for (auto &range : m_underlines) {
+    if (range[0] <= modified_end && range[1] >= position) {
+      modified = {std::min(modified[0], shift(range[0])), std::max(modified[1], shift(range[1]))};
+      range = {};
+    } else
+      range = {shift(range[0]), shift(range[1])};
+  }
+  std::erase(m_underlines, Range{});
+  for (auto &range : m_unknown)
+    range = {shift(range[0]), shift(range[1])};
+  m_unknown.push_back(modified);
+  merge(m_unknown);
+}
+
+void AppliedUnderlines::invalidate(TextPosition from, TextPosition to) {
+  Range invalidated{from, to};
+  // underlines are known only as a whole
+  for (auto &range : m_underlines) {
+    if (intersects(range, invalidated)) {
+      invalidated = {std::min(invalidated[0], range[0]), std::max(invalidated[1], range[1])};
+      range = {};
+    }
+  }
+  std::erase(m_underlines, Range{});
+  m_unknown.push_back(invalidated);
+  merge(m_unknown);
+}
+
+std::vector<Range> AppliedUnderlines::underlines(TextPosition from, TextPosition to) const {
+  std::vector<Range> result;
+  Range requested{from, to};
+  auto it = std::ranges::lower_bound(m_underlines, from, {}, [](const Range &range) { return range[1]; });
+  for (; it != m_underlines.end() && (*it)[0] < to; ++it)
+    if (intersects(*it, requested))
+      result.push_back(*it);
+  return result;
+}
+
+bool AppliedUnderlines::is_known(TextPosition position) const {
+  return std::ranges::none_of(m_unknown, [&](const Range &range) { return range[0] <= position && position < range[1]; });
+}
@@ -0,0 +1,53 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "plugin/Constants.h"
+
+#include <array>
+#include <vector>
+
+// Underlines which were applied to a single document last time,
+// used to send editor only the operations which actually change something
+// Parts of document which state is not known (never checked or modified afterwards) are tracked separately
+class AppliedUnderlines {
+public:
+  using Range = std::array<TextPosition, 2>;
+
+  class Operations {
+  public:
+    std::vector<Range> to_clear;
+    std::vector<Range> to_fill;
+
+    bool empty() const { return to_clear.empty() && to_fill.empty(); }
+  };
+
+  explicit AppliedUnderlines(TextPosition document_length = 0);
+  // Computes operations required for underlines in [from, to) to become exactly `underlines` and remembers the result
+  // `underlines` should be sorted
+  Operations update(TextPosition from, TextPosition to, const std::vector<Range> &underlines);
+  void on_text_modified(TextPosition position, TextPosition length, bool is_insertion);
+  // Forgets state of [from, to), e.g. when underlines were changed by someone else
+  void invalidate(TextPosition from, TextPosition to);
+  // Applied underlines intersecting [from, to), parts of document with unknown state are not included
+  std::vector<Range> underlines(TextPosition from, TextPosition to) const;
+  bool is_known(TextPosition position) const;
+  TextPosition document_length() const { return m_document_length; }
+
+private:
+  TextPosition m_document_length;
+  std::vector<Range> m_underlines;
+  std::vector<Range> m_unknown;
+};
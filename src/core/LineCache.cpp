@@ -0,0 +1,77 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "LineCache.h"
+
+#include "RangeStyleInfo.h"
+
+namespace {
+// Lines of a single document seen since the last invalidation, mostly matters for huge files scrolled from top to bottom
+constexpr size_t max_cached_line_count = 10000;
+
+template <typename T>
+void hash_combine(size_t &seed, const T &value) {
+  seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+} // namespace
+
+size_t LineCache::calculate_hash(std::string_view line_bytes, TextPosition from, TextPosition offset_in_line, const RangeStyleInfo &style_info,
+                                 int encoding) {
+  size_t hash = std::hash<std::string_view>{}(line_bytes);
+  hash_combine(hash, offset_in_line);
+  hash_combine(hash, style_info.lexer());
+  hash_combine(hash, encoding);
+  auto to = from + static_cast<TextPosition>(line_bytes.size());
+  // styles are hashed by runs, usually there are only a few of them per line
+  auto styles = style_info.styles(from, to);
+  for (size_t i = 0; i < styles.size(); ++i) {
+    if (i > 0 && styles[i] == styles[i - 1])
+      continue;
+    hash_combine(hash, i);
+    hash_combine(hash, styles[i]);
+  }
+  for (auto [start, end] : style_info.url_runs()) {
+    if (end <= from || start >= to)
+      continue;
+    hash_combine(hash, std::max(start, from) - from);
+    hash_combine(hash, std::min(end, to) - from);
+  }
+  return hash;
+}
+
+const LineCache::Misspellings *LineCache::find(const std::wstring &document, TextPosition line, size_t hash) {
+  if (auto doc_it = m_documents.find(document); doc_it != m_documents.end()) {
+    if (auto it = doc_it->second.find(line); it != doc_it->second.end() && it->second.hash == hash) {
+      ++m_hit_count;
+      return &it->second.misspellings;
+    }
+  }
+  ++m_miss_count;
+  return nullptr;
+}
+
+void LineCache::store(const std::wstring &document, TextPosition line, size_t hash, Misspellings misspellings) {
+  auto &lines = m_documents[document];
+  if (lines.size() >= max_cached_line_count)
+    lines.clear();
+  lines[line] = {hash, std::move(misspellings)};
+}
+
+void LineCache::clear() {
+  m_documents.clear();
+}
+
+void LineCache::clear_document(const std::wstring &document) {
+  m_documents.erase(document);
+}
@@ -0,0 +1,56 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "plugin/Constants.h"
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class RangeStyleInfo;
+
+// Remembers misspelled spans of already checked lines, so lines which didn't change are not sent to speller again
+// Line is identified by its number and a hash of everything which affected the check result (see `calculate_hash`)
+class LineCache {
+public:
+  // Positions are relative to line start
+  using Misspellings = std::vector<std::array<TextPosition, 2>>;
+
+  // Styles and URL indicators of the whole range are a part of the hash, since they decide which words are checked
+  static size_t calculate_hash(std::string_view line_bytes, TextPosition from, TextPosition offset_in_line, const RangeStyleInfo &style_info,
+                               int encoding);
+  // returns nullptr if line wasn't cached or its content has changed
+  const Misspellings *find(const std::wstring &document, TextPosition line, size_t hash);
+  void store(const std::wstring &document, TextPosition line, size_t hash, Misspellings misspellings);
+  void clear();
+  void clear_document(const std::wstring &document);
+
+  size_t hit_count() const { return m_hit_count; }
+  size_t miss_count() const { return m_miss_count; }
+
+private:
+  class Entry {
+  public:
+    size_t hash = 0;
+    Misspellings misspellings;
+  };
+
+  std::unordered_map<std::wstring, std::unordered_map<TextPosition, Entry>> m_documents;
+  size_t m_hit_count = 0;
+  size_t m_miss_count = 0;
+};
@@ -0,0 +1,157 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "MisspellingIndex.h"
+
+#include <ranges>
+
+namespace {
+// after too many scattered modifications it's cheaper to build index again
+constexpr size_t max_dirty_range_count = 1000;
+}
+
+void MisspellingIndex::start_building(std::wstring document, TextPosition document_length) {
+  clear();
+  m_state = State::building;
+  m_document = std::move(document);
+  m_document_length = document_length;
+}
+
+void MisspellingIndex::finish_building() {
+  m_state = State::ready;
+}
+
+void MisspellingIndex::clear() {
+  m_state = State::empty;
+  m_document.clear();
+  m_document_length = 0;
+  m_ranges.clear();
+  m_gap = 0;
+  m_shift = 0;
+  m_dirty_ranges.clear();
+}
+
+bool MisspellingIndex::is_empty() const { return m_state == State::empty; }
+
+bool MisspellingIndex::is_building_for(const std::wstring &document) const {
+  return m_state == State::building && m_document == document;
+}
+
+bool MisspellingIndex::is_ready_for(const std::wstring &document, TextPosition document_length) const {
+  return m_state == State::ready && m_document == document && m_document_length == document_length;
+}
+
+MisspellingIndex::Range MisspellingIndex::range_at(size_t index) const {
+  auto &range = m_ranges[index];
+  return index < m_gap ? range : Range{range[0] + m_shift, range[1] + m_shift};
+}
+
+template <typename Pred>
+size_t MisspellingIndex::partition_point(Pred pred) const {
+  return *std::ranges::partition_point(std::views::iota(size_t{0}, m_ranges.size()), [&](size_t index) { return pred(range_at(index)); });
+}
+
+void MisspellingIndex::move_gap(size_t index) {
+  for (; m_gap < index; ++m_gap)
+    m_ranges[m_gap] = {m_ranges[m_gap][0] + m_shift, m_ranges[m_gap][1] + m_shift};
+  for (; m_gap > index; --m_gap)
+    m_ranges[m_gap - 1] = {m_ranges[m_gap - 1][0] - m_shift, m_ranges[m_gap - 1][1] - m_shift};
+  if (m_gap == m_ranges.size())
+    m_shift = 0;
+}
+
+void MisspellingIndex::add(const Range &range) {
+  move_gap(m_ranges.size());
+  m_ranges.push_back(range);
+  ++m_gap;
+}
+
+void MisspellingIndex::replace(TextPosition from, TextPosition to, const std::vector<Range> &ranges) {
+  auto first = partition_point([&](const Range &range) { return range[0] < from; });
+  auto last = partition_point([&](const Range &range) { return range[0] <= to; });
+  move_gap(first);
+  auto it = m_ranges.erase(m_ranges.begin() + first, m_ranges.begin() + last);
+  m_ranges.insert(it, ranges.begin(), ranges.end());
+  // new ranges are already shifted
+  m_gap = first + ranges.size();
+}
+
+void MisspellingIndex::remove(const Range &range) {
+  auto index = partition_point([&](const Range &r) { return r < range; });
+  if (index == m_ranges.size() || range_at(index) != range)
+    return;
+  move_gap(index);
+  m_ranges.erase(m_ranges.begin() + index);
+}
+
+void MisspellingIndex::on_text_modified(TextPosition position, TextPosition length, bool is_insertion) {
+  if (m_state == State::building) {
+    // text snapshot used for building is not valid anymore
+    clear();
+    return;
+  }
+  if (m_state != State::ready)
+    return;
+
+  m_document_length += is_insertion ? length : -length;
+  auto modified_end = is_insertion ? position : position + length;
+  // words touching modified text are changed and will be rechecked as a part of dirty range
+  auto first = partition_point([&](const Range &range) { return range[1] < position; });
+  auto last = partition_point([&](const Range &range) { return range[0] <= modified_end; });
+  move_gap(first);
+  m_ranges.erase(m_ranges.begin() + first, m_ranges.begin() + std::max(first, last));
+  // the rest start after modified text
+  if (m_gap < m_ranges.size())
+    m_shift += is_insertion ? length : -length;
+
+  auto shift = [&](TextPosition pos) {
+    if (pos < position)
+      return pos;
+    if (is_insertion)
+      return pos + length;
+    return pos >= position + length ? pos - length : position;
+  };
+  for (auto &range : m_dirty_ranges)
+    range = {shift(range[0]), shift(range[1])};
+  m_dirty_ranges.push_back({position, is_insertion ? position + length : position});
+  if (m_dirty_ranges.size() > max_dirty_range_count)
+    clear();
+}
+
+std::vector<MisspellingIndex::Range> MisspellingIndex::take_dirty_ranges() {
+  auto ranges = std::exchange(m_dirty_ranges, {});
+  std::ranges::sort(ranges);
+  std::vector<Range> result;
+  for (auto &range : ranges) {
+    if (!result.empty() && range[0] <= result.back()[1])
+      result.back()[1] = std::max(result.back()[1], range[1]);
+    else
+      result.push_back(range);
+  }
+  return result;
+}
+
+std::optional<MisspellingIndex::Range> MisspellingIndex::find_next(TextPosition position) const {
+  auto index = partition_point([&](const Range &range) { return range[1] <= position; });
+  if (index == m_ranges.size())
+    return std::nullopt;
+  return range_at(index);
+}
+
+std::optional<MisspellingIndex::Range> MisspellingIndex::find_prev(TextPosition position) const {
+  auto index = partition_point([&](const Range &range) { return range[1] < position; });
+  if (index == 0)
+    return std::nullopt;
+  return range_at(index - 1);
+}
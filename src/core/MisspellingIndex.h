@@ -0,0 +1,77 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "plugin/Constants.h"
+
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Sorted misspelled ranges of the whole document, used to find next/previous mistake without rechecking the text
+// Index is filled by SpellChecker in background and kept up to date using modification notifications,
+// modified places are remembered as dirty ranges which should be rechecked before the next lookup
+// Shift caused by modifications is applied lazily to ranges after a movable gap, like text in a gap buffer,
+// so consecutive edits at the same place don't touch ranges after it
+class MisspellingIndex {
+public:
+  using Range = std::array<TextPosition, 2>;
+
+  void start_building(std::wstring document, TextPosition document_length);
+  void finish_building();
+  void clear();
+  bool is_empty() const;
+  bool is_building_for(const std::wstring &document) const;
+  bool is_ready_for(const std::wstring &document, TextPosition document_length) const;
+  const std::wstring &document() const { return m_document; }
+
+  // Ranges should be added in ascending order
+  void add(const Range &range);
+  // Replaces all ranges starting within [from, to] with `ranges`
+  void replace(TextPosition from, TextPosition to, const std::vector<Range> &ranges);
+  void remove(const Range &range);
+  void on_text_modified(TextPosition position, TextPosition length, bool is_insertion);
+  // Returns merged dirty ranges in ascending order
+  std::vector<Range> take_dirty_ranges();
+
+  // First misspelling ending after position
+  std::optional<Range> find_next(TextPosition position) const;
+  // Last misspelling ending before position
+  std::optional<Range> find_prev(TextPosition position) const;
+  size_t size() const { return m_ranges.size(); }
+
+private:
+  Range range_at(size_t index) const;
+  // Index of the first range for which `pred` is false, ranges are partitioned by it
+  template <typename Pred>
+  size_t partition_point(Pred pred) const;
+  void move_gap(size_t index);
+
+  enum class State {
+    empty,
+    building,
+    ready,
+  };
+
+  State m_state = State::empty;
+  std::wstring m_document;
+  TextPosition m_document_length = 0;
+  // ranges starting from m_gap are stored without m_shift
+  std::vector<Range> m_ranges;
+  size_t m_gap = 0;
+  TextPosition m_shift = 0;
+  std::vector<Range> m_dirty_ranges;
+};
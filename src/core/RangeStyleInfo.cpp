@@ -0,0 +1,40 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "RangeStyleInfo.h"
+
+#include "npp/EditorInterface.h"
+#include "PluginInterface.h"
+
+#include <cassert>
+
+RangeStyleInfo::RangeStyleInfo(const EditorInterface &editor, TextPosition from, TextPosition to)
+  : m_from(from), m_lexer(editor.get_lexer()), m_styles(editor.get_styles(from, to)),
+    m_url_runs(editor.get_indicator_runs(URL_INDIC, from, to)) {
+}
+
+int RangeStyleInfo::style_at(TextPosition position) const {
+  assert(position >= m_from && position - m_from < static_cast<TextPosition>(m_styles.size()));
+  return m_styles[position - m_from];
+}
+
+std::span<const int> RangeStyleInfo::styles(TextPosition from, TextPosition to) const {
+  assert(from >= m_from && from <= to && to - m_from <= static_cast<TextPosition>(m_styles.size()));
+  return std::span(m_styles).subspan(from - m_from, to - from);
+}
+
+bool RangeStyleInfo::is_url_at(TextPosition position) const {
+  auto it = std::upper_bound(m_url_runs.begin(), m_url_runs.end(), position, [](TextPosition pos, const auto &run) { return pos < run[0]; });
+  return it != m_url_runs.begin() && position < (*std::prev(it))[1];
+}
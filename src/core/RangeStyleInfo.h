@@ -0,0 +1,43 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "plugin/Constants.h"
+
+#include <array>
+#include <span>
+#include <vector>
+
+class EditorInterface;
+
+// Styles and URL indicator runs of a text range fetched from editor in bulk,
+// so filtering every token of the range doesn't cost several messages to Scintilla
+class RangeStyleInfo {
+public:
+  RangeStyleInfo(const EditorInterface &editor, TextPosition from, TextPosition to);
+  int lexer() const { return m_lexer; }
+  // Positions outside of the range are not allowed
+  int style_at(TextPosition position) const;
+  bool is_url_at(TextPosition position) const;
+  std::span<const int> styles(TextPosition from, TextPosition to) const;
+  const std::vector<std::array<TextPosition, 2>> &url_runs() const { return m_url_runs; }
+
+private:
+  TextPosition m_from = 0;
+  int m_lexer = 0;
+  std::vector<int> m_styles;
+  // sorted non-overlapping runs [start, end)
+  std::vector<std::array<TextPosition, 2>> m_url_runs;
+};
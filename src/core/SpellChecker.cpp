@@ -14,8 +14,10 @@
 
 #include "SpellChecker.h"
 
+#include "RangeStyleInfo.h"
 #include "SpellCheckerHelpers.h"
 #include "common/Utility.h"
+#include "common/string_utils.h"
 #include "npp/EditorInterface.h"
 #include "npp/NppInterface.h"
 #include "plugin/Constants.h"
@@ -26,11 +28,29 @@
 #include "spellers/SpellerInterface.h"
 
 #include <ranges>
+#include <unordered_map>
+
+namespace {
+// for smaller documents find next/previous mistake is fast enough without index
+constexpr TextPosition misspelling_index_min_document_length = 1 << 20;
+// index is built by portions of this size to not block GUI thread for long
+constexpr TextPosition misspelling_index_portion_length = 1 << 16;
+// whole document commands process text by chunks of this size (in bytes)
+constexpr TextPosition document_chunk_length = 1 << 20;
+// find next/previous mistake checks words in batches growing between these sizes, so a misspelling close to the cursor costs few speller calls
+constexpr size_t min_check_batch_size = 8;
+constexpr size_t max_check_batch_size = 256;
+} // namespace
 
 SpellChecker::SpellChecker(const Settings *settings, EditorInterface &editor, const SpellerContainer &speller_container)
-  : m_settings(*settings), m_editor(editor), m_speller_container(speller_container) {
+  : m_settings(*settings), m_editor(editor), m_speller_container(speller_container),
+    m_misspelling_index_task(editor.get_editor_hwnd()) {
   m_settings.settings_changed.connect([this] { on_settings_changed(); });
-  m_speller_container.speller_status_changed.connect([this] { recheck_visible_both_views(); });
+  m_speller_container.speller_status_changed.connect([this] {
+    m_line_cache.clear();
+    reset_misspelling_index();
+    recheck_visible_both_views();
+  });
   on_settings_changed();
 }
 
@@ -52,6 +72,9 @@ void SpellChecker::recheck_visible_on_active_view() {
 
 void SpellChecker::find_next_mistake() {
   ACTIVE_VIEW_BLOCK(m_editor);
+  if (find_mistake_using_index(true))
+    return;
+
   auto current_position = m_editor.get_current_pos();
   auto doc_length = m_editor.get_active_document_length();
   auto iterator_pos = prev_token_begin_in_document(current_position);
@@ -93,6 +116,9 @@ void SpellChecker::find_next_mistake() {
 
 void SpellChecker::find_prev_mistake() {
   ACTIVE_VIEW_BLOCK(m_editor);
+  if (find_mistake_using_index(false))
+    return;
+
   auto current_position = m_editor.get_current_pos();
   auto doc_length = m_editor.get_active_document_length();
 
@@ -132,6 +158,84 @@ void SpellChecker::find_prev_mistake() {
   }
 }
 
+bool SpellChecker::find_mistake_using_index(bool next) {
+  auto document = m_editor.get_full_current_path();
+  auto doc_length = m_editor.get_active_document_length();
+  if (!m_misspelling_index.is_ready_for(document, doc_length)) {
+    if (doc_length >= misspelling_index_min_document_length && !m_misspelling_index.is_building_for(document))
+      start_misspelling_index_building();
+    return false;
+  }
+
+  recheck_misspelling_index_dirty_ranges();
+  auto current_position = m_editor.get_current_pos();
+  while (true) {
+    auto range = next ? m_misspelling_index.find_next(current_position) : m_misspelling_index.find_prev(current_position);
+    if (!range)
+      range = next ? m_misspelling_index.find_next(-1) : m_misspelling_index.find_prev(doc_length + 1);
+    if (!range)
+      return true;
+
+    auto [start, end] = *range;
+    // styles could change outside of modified lines (after opening multiline comment for example) so result is verified
+    // character after the word is taken to keep `ends_with_dot` check the same
+    auto text = m_editor.get_mapped_wstring_range(start, std::min(end + 1, doc_length));
+    auto word = std::wstring_view(text.str).substr(0, text.from_original_index(end));
+    if (!check_word(word, start)) {
+      m_editor.set_selection(start, end);
+      return true;
+    }
+    m_misspelling_index.remove(*range);
+  }
+}
+
+void SpellChecker::start_misspelling_index_building() {
+  print_to_log(L"void SpellChecker::start_misspelling_index_building()", m_editor.get_editor_hwnd());
+  m_misspelling_index.start_building(m_editor.get_full_current_path(), m_editor.get_active_document_length());
+  continue_misspelling_index_building(0);
+}
+
+void SpellChecker::continue_misspelling_index_building(TextPosition offset) {
+  ACTIVE_VIEW_BLOCK(m_editor);
+  // document could be switched in the meantime, modifications reset the index by themselves
+  if (!m_misspelling_index.is_building_for(m_editor.get_full_current_path()))
+    return reset_misspelling_index();
+
+  // portions are read from the document directly, so no copy of the whole text is made
+  auto end = offset;
+  if (offset < m_editor.get_active_document_length())
+    end = for_each_misspelling_in_chunk(offset, misspelling_index_portion_length,
+                                        [this](const SpellerWordData &word) { m_misspelling_index.add({word.word_start, word.word_end}); });
+
+  if (end == m_editor.get_active_document_length()) {
+    m_misspelling_index.finish_building();
+    print_to_log(wstring_printf(L"Misspelling index is built, %zu misspellings found", m_misspelling_index.size()), m_editor.get_editor_hwnd());
+    return;
+  }
+
+  // giving GUI thread a chance to process other messages before the next portion
+  m_misspelling_index_task.do_deferred([end](concurrency::cancellation_token) { return end; },
+                                       [this](TextPosition end) { continue_misspelling_index_building(end); });
+}
+
+void SpellChecker::recheck_misspelling_index_dirty_ranges() {
+  for (auto [from, to] : m_misspelling_index.take_dirty_ranges()) {
+    auto line_start = m_editor.get_line_start_position(m_editor.line_from_position(from));
+    auto line_end = m_editor.get_line_end_position(m_editor.line_from_position(to));
+    m_editor.force_style_update(line_start, line_end);
+    std::vector<MisspellingIndex::Range> misspellings;
+    for (auto &word : check_text(m_editor.get_mapped_wstring_range(line_start, line_end)))
+      if (!word.is_correct)
+        misspellings.push_back({word.word_start, word.word_end});
+    m_misspelling_index.replace(line_start, line_end, misspellings);
+  }
+}
+
+void SpellChecker::reset_misspelling_index() {
+  m_misspelling_index_task.cancel();
+  m_misspelling_index.clear();
+}
+
 WordForSpeller SpellChecker::to_word_for_speller(std::wstring_view word) const {
   WordForSpeller res;
   res.data.ends_with_dot = *(word.data() + word.length()) == '.';
@@ -159,18 +263,49 @@ void SpellChecker::refresh_underline_style() {
 }
 
 void SpellChecker::on_settings_changed() {
+  m_line_cache.clear();
+  reset_misspelling_index();
   refresh_underline_style();
   recheck_visible_both_views();
 }
 
-void SpellChecker::create_word_underline(TextPosition start, TextPosition end) const {
-  m_editor.set_current_indicator(spell_check_indicator_id);
-  m_editor.indicator_fill_range(start, end);
+void SpellChecker::on_document_closed(const std::wstring &document) {
+  m_line_cache.clear_document(document);
+  m_applied_underlines.erase(document);
+  std::erase_if(m_underlined_documents, [&](const auto &p) { return p.second == document; });
 }
 
-void SpellChecker::remove_underline(TextPosition start, TextPosition end) const {
-  m_editor.set_current_indicator(spell_check_indicator_id);
-  m_editor.indicator_clear_range(start, end);
+void SpellChecker::on_indicator_changed(TextPosition position, TextPosition length) {
+  // our own operations are reported while they're sent, the model already describes their result
+  if (m_is_applying_underlines)
+    return;
+  auto document_it = m_underlined_documents.find(m_editor.get_target_view());
+  if (document_it == m_underlined_documents.end())
+    return;
+  auto it = m_applied_underlines.find(document_it->second);
+  // length mismatch means that another document is shown now, its model is dropped on the next pass anyway
+  if (it == m_applied_underlines.end() || it->second.document_length() != m_editor.get_active_document_length())
+    return;
+  // notification doesn't tell which indicator was changed, so applied underlines inside the range are compared with the editor
+  auto &applied = it->second;
+  auto end = position + length;
+  auto underlines = applied.underlines(position, end);
+  bool matches = std::ranges::all_of(underlines, [&](const AppliedUnderlines::Range &range) {
+    return m_editor.get_indicator_value_at(spell_check_indicator_id, std::max(range[0], position)) != 0;
+  });
+  if (matches && (underlines.empty() || underlines.front()[0] > position) && applied.is_known(position))
+    matches = m_editor.get_indicator_value_at(spell_check_indicator_id, position) == 0;
+  if (!matches)
+    applied.invalidate(position, end);
+}
+
+AppliedUnderlines &SpellChecker::applied_underlines(const std::wstring &document) {
+  auto length = m_editor.get_active_document_length();
+  auto it = m_applied_underlines.find(document);
+  // length mismatch means that some modifications were missed, so nothing is known about the document
+  if (it == m_applied_underlines.end() || it->second.document_length() != length)
+    it = m_applied_underlines.insert_or_assign(document, AppliedUnderlines(length)).first;
+  return it->second;
 }
 
 TextPosition SpellChecker::prev_token_begin_in_document(TextPosition start) const {
@@ -210,17 +345,26 @@ TextPosition SpellChecker::next_token_end_in_document(TextPosition end) const {
   return end;
 }
 
-MappedWstring SpellChecker::get_visible_text() {
+class LineRange {
+public:
+  TextPosition line;
+  TextPosition line_start;
+  TextPosition from;
+  TextPosition to;
+};
+
+std::vector<LineRange> SpellChecker::get_visible_line_ranges() {
   auto top_visible_line = m_editor.get_first_visible_line();
   auto top_visible_line_index = m_editor.get_document_line_from_visible(top_visible_line);
   auto bottom_visible_line_index = m_editor.get_document_line_from_visible(top_visible_line + m_editor.get_lines_on_screen() - 1);
   auto rect = m_editor.editor_rect();
   auto len = m_editor.get_active_document_length();
-  MappedWstring result;
+  std::vector<LineRange> result;
   for (auto line = top_visible_line_index; line <= bottom_visible_line_index; ++line) {
     if (!m_editor.is_line_visible(line))
       continue;
-    auto start = m_editor.get_line_start_position(line);
+    auto line_start = m_editor.get_line_start_position(line);
+    auto start = line_start;
     if (start >= len) // skipping possible empty lines when document is too short
       continue;
     auto start_point = m_editor.get_point_from_position(start);
@@ -240,18 +384,13 @@ MappedWstring SpellChecker::get_visible_text() {
       end = m_editor.char_position_from_point({rect.right - rect.left, end_point.y});
       end = next_token_end_in_document(end);
     }
-    auto new_str = m_editor.get_mapped_wstring_range(start, end);
-    result.append(new_str);
+    result.push_back({line, line_start, start, end});
   }
   return result;
 }
 
-void SpellChecker::clear_all_underlines() const {
-  auto length = m_editor.get_active_document_length();
-  if (length > 0) {
-    m_editor.set_current_indicator(spell_check_indicator_id);
-    m_editor.indicator_clear_range(0, length);
-  }
+void SpellChecker::clear_all_underlines() {
+  underline_misspellings(m_editor.get_full_current_path(), {}, 0, m_editor.get_active_document_length());
 }
 
 bool SpellChecker::is_spellchecking_needed(std::wstring_view word, TextPosition word_start) const {
@@ -261,6 +400,13 @@ bool SpellChecker::is_spellchecking_needed(std::wstring_view word, TextPosition
   return SpellCheckerHelpers::is_word_spell_checking_needed(m_settings, m_editor, word, word_start);
 }
 
+bool SpellChecker::is_spellchecking_needed(std::wstring_view word, TextPosition word_start, const RangeStyleInfo &style_info) const {
+  if (!m_speller_container.active_speller().is_working())
+    return false;
+
+  return SpellCheckerHelpers::is_word_spell_checking_needed(m_settings, style_info, word, word_start);
+}
+
 bool SpellChecker::is_word_under_cursor_correct(TextPosition &pos, TextPosition &length, bool use_text_cursor) const {
   TextPosition init_char_pos, selection_start = 0, selection_end = 0;
   ACTIVE_VIEW_BLOCK(m_editor);
@@ -304,16 +450,14 @@ bool SpellChecker::is_word_under_cursor_correct(TextPosition &pos, TextPosition
 
 void SpellChecker::erase_all_misspellings() {
   ACTIVE_VIEW_BLOCK(m_editor);
-  auto mapped_str = m_editor.to_mapped_wstring(m_editor.get_active_document_text());
-  auto misspelled_words = get_misspelled_words(mapped_str);
+  std::vector<std::array<TextPosition, 2>> misspellings;
+  for_each_misspelling_in_document([&](const SpellerWordData &word) { misspellings.push_back({word.word_start, word.word_end}); });
 
   UNDO_BLOCK(m_editor);
   TextPosition chars_removed = 0;
-  for (auto &misspelling : misspelled_words) {
-    auto start = mapped_str.to_original_index(misspelling.data() - mapped_str.str.data());
-    auto original_len = mapped_str.to_original_index(static_cast<TextPosition>(misspelling.data() - mapped_str.str.data() + misspelling.length())) - start;
-    m_editor.delete_range(start - chars_removed, original_len);
-    chars_removed += original_len;
+  for (auto &[start, end] : misspellings) {
+    m_editor.delete_range(start - chars_removed, end - start);
+    chars_removed += end - start;
   }
 }
 
@@ -343,35 +487,48 @@ public:
   bool is_correct;
 };
 
-std::vector<SpellerWordData> SpellChecker::check_text(const MappedWstring &text_to_check) const {
+std::optional<SpellerWordData> SpellChecker::to_word_to_check(const MappedWstring &text, std::wstring_view token, const RangeStyleInfo &style_info,
+                                                              MappedWstring::Hint &hint) const {
+  SpellCheckerHelpers::cut_apostrophes(m_settings, token);
+  auto word_start = text.to_original_index(token.data() - text.str.data(), hint);
+  if (!is_spellchecking_needed(token, word_start, style_info))
+    return std::nullopt;
+
+  SpellerWordData word;
+  word.word_for_speller = to_word_for_speller(token);
+  word.word_start = word_start;
+  word.word_end = text.to_original_index(static_cast<TextPosition>(token.data() - text.str.data() + token.length()), hint);
+  word.token = token;
+  return word;
+}
+
+std::vector<SpellerWordData> SpellChecker::check_text(const MappedWstring &text_to_check, bool in_parallel) const {
+  if (text_to_check.str.empty())
+    return {};
+  RangeStyleInfo style_info(m_editor, text_to_check.to_original_index(0),
+                            text_to_check.to_original_index(static_cast<TextPosition>(text_to_check.str.size())));
+  return check_text(text_to_check, style_info, in_parallel);
+}
+
+std::vector<SpellerWordData> SpellChecker::check_text(const MappedWstring &text_to_check, const RangeStyleInfo &style_info, bool in_parallel) const {
   if (text_to_check.str.empty())
     return {};
   auto sv = std::wstring_view(text_to_check.str);
   std::vector<std::wstring_view> tokens;
   m_settings.do_with_tokenizer(sv, [&](const auto &tokenizer) { tokens = tokenizer.get_all_tokens(); });
 
-  std::vector<bool> results(tokens.size());
   std::vector<SpellerWordData> words_to_check;
-  words_to_check.clear();
   std::vector<WordForSpeller> words_for_speller;
+  MappedWstring::Hint hint;
   for (auto token : tokens) {
-    SpellCheckerHelpers::cut_apostrophes(m_settings, token);
-    auto word_start = text_to_check.to_original_index(token.data() - text_to_check.str.data());
-    auto word_end = text_to_check.to_original_index(
-        static_cast<TextPosition>(token.data() - text_to_check.str.data() + token.length()));
-    if (is_spellchecking_needed(token, word_start)) {
-      words_to_check.emplace_back();
-      auto &w = words_to_check.back();
-      w.word_for_speller = to_word_for_speller(token);
-      w.word_start = word_start;
-      w.word_end = word_end;
-      w.token = token;
-    }
+    if (auto word = to_word_to_check(text_to_check, token, style_info, hint))
+      words_to_check.push_back(std::move(*word));
   }
   words_for_speller.resize(words_to_check.size());
   std::transform(words_to_check.begin(), words_to_check.end(),
                  words_for_speller.begin(), [](auto &word) -> auto&& { return std::move(word.word_for_speller); });
-  auto spellcheck_result = m_speller_container.active_speller().check_words(words_for_speller);
+  auto &speller = m_speller_container.active_speller();
+  auto spellcheck_result = in_parallel ? speller.check_words_in_parallel(words_for_speller) : speller.check_words(words_for_speller);
   if (!spellcheck_result.empty()) {
     for (int i = 0; i < static_cast<int>(words_for_speller.size()); ++i)
       words_to_check[i].is_correct = spellcheck_result[i];
@@ -381,67 +538,262 @@ std::vector<SpellerWordData> SpellChecker::check_text(const MappedWstring &text_
   return words_to_check;
 }
 
-void SpellChecker::underline_misspelled_words(const MappedWstring &text_to_check) const {
-  std::vector<TextPosition> underline_buffer;
-  auto words_to_check = check_text(text_to_check);
-  for (auto &result : words_to_check) {
-    if (result.is_correct)
+void SpellChecker::check_line_ranges(const std::vector<LineRange> &ranges, TextPosition from, TextPosition to) {
+  auto document = m_editor.get_full_current_path();
+  auto encoding = static_cast<int>(m_editor.get_encoding());
+  std::vector<LineCache::Misspellings> range_misspellings(ranges.size());
+  std::vector<std::pair<size_t, size_t>> missed_ranges; // (range index, hash)
+  MappedWstring text_to_check;
+  RangeStyleInfo style_info(m_editor, ranges.empty() ? from : ranges.front().from, ranges.empty() ? from : ranges.back().to);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    auto &range = ranges[i];
+    auto bytes = m_editor.get_text_range_view(range.from, range.to);
+    auto hash = LineCache::calculate_hash(bytes, range.from, range.from - range.line_start, style_info, encoding);
+    if (auto cached = m_line_cache.find(document, range.line, hash)) {
+      for (auto &[start, end] : *cached)
+        range_misspellings[i].push_back({range.line_start + start, range.line_start + end});
       continue;
-    std::array list{result.word_start, result.word_end};
-    underline_buffer.insert(underline_buffer.end(), list.begin(), list.end());
+    }
+    auto mapped_str = m_editor.to_mapped_wstring(bytes);
+    mapped_str.mapping.add_offset(range.from);
+    text_to_check.append(mapped_str);
+    missed_ranges.emplace_back(i, hash);
   }
-  TextPosition prev_pos = 0;
-  for (TextPosition i = 0; i < static_cast<TextPosition>(underline_buffer.size()) - 1; i += 2) {
-    remove_underline(prev_pos, underline_buffer[i]);
-    create_word_underline(underline_buffer[i], underline_buffer[i + 1]);
-    prev_pos = underline_buffer[i + 1];
+
+  auto words = check_text(text_to_check, style_info);
+  auto word_it = words.begin();
+  for (auto [index, hash] : missed_ranges) {
+    auto &range = ranges[index];
+    LineCache::Misspellings to_store;
+    for (; word_it != words.end() && word_it->word_start < range.to; ++word_it) {
+      if (word_it->is_correct)
+        continue;
+      range_misspellings[index].push_back({word_it->word_start, word_it->word_end});
+      to_store.push_back({word_it->word_start - range.line_start, word_it->word_end - range.line_start});
+    }
+    m_line_cache.store(document, range.line, hash, std::move(to_store));
   }
-  auto text_len = text_to_check.original_length();
-  remove_underline(prev_pos, text_len);
+
+  LineCache::Misspellings misspellings;
+  for (auto &list : range_misspellings)
+    misspellings.insert(misspellings.end(), list.begin(), list.end());
+  underline_misspellings(document, misspellings, from, to);
+  print_to_log(wstring_printf(L"Line cache hits: %zu, misses: %zu", m_line_cache.hit_count(), m_line_cache.miss_count()),
+               m_editor.get_editor_hwnd());
 }
 
-std::vector<std::wstring_view> SpellChecker::get_misspelled_words(const MappedWstring &text_to_check) const {
-  auto words_to_check = check_text(text_to_check);
-  std::vector<std::wstring_view> misspelled_words;
-  using namespace std::ranges;
-  copy(words_to_check |
-       views::filter(std::not_fn(&SpellerWordData::is_correct)) |
-       views::transform(&SpellerWordData::token),
-       std::back_inserter(misspelled_words));
-  return misspelled_words;
+void SpellChecker::underline_misspellings(const std::wstring &document, const LineCache::Misspellings &misspellings, TextPosition from,
+                                          TextPosition to) {
+  m_underlined_documents[m_editor.get_target_view()] = document;
+  auto operations = applied_underlines(document).update(from, to, misspellings);
+  if (operations.empty())
+    return;
+
+  m_is_applying_underlines = true;
+  m_editor.set_current_indicator(spell_check_indicator_id);
+  for (auto &[start, end] : operations.to_clear)
+    if (start < end)
+      m_editor.indicator_clear_range(start, end);
+  for (auto &[start, end] : operations.to_fill)
+    m_editor.indicator_fill_range(start, end);
+  m_is_applying_underlines = false;
 }
 
-std::optional<std::array<TextPosition, 2>> SpellChecker::find_first_misspelling(const MappedWstring &text_to_check, TextPosition last_valid_position) const {
-  auto words_to_check = check_text(text_to_check);
-  auto it = std::ranges::find_if(words_to_check, [last_valid_position](const SpellerWordData &data) {
-    return !data.is_correct && data.word_end > last_valid_position;
-  });
-  if (it == words_to_check.end())
-    return {};
+void SpellChecker::for_each_misspelling_in_document(const std::function<void(const SpellerWordData &word)> &callback) const {
+  auto length = m_editor.get_active_document_length();
+  TextPosition from = 0;
+  while (from < length)
+    from = for_each_misspelling_in_chunk(from, document_chunk_length, callback);
+}
+
+TextPosition SpellChecker::for_each_misspelling_in_chunk(TextPosition from, TextPosition max_length,
+                                                         const std::function<void(const SpellerWordData &word)> &callback) const {
+  auto length = m_editor.get_active_document_length();
+  auto to = std::min(from + max_length, length);
+  auto text = m_editor.get_text_range_view(from, to);
+  bool is_cut_at_line_break = false;
+  if (to < length) {
+    // line breaks are delimiters for every tokenization style and never a part of multibyte character
+    if (auto pos = text.rfind('\n'); pos != std::string_view::npos) {
+      text = text.substr(0, pos + 1);
+      is_cut_at_line_break = true;
+    } else {
+      // view has to be requested again since any other request could invalidate it
+      text = m_editor.get_text_range_view(from, m_editor.get_prev_valid_begin_pos(to));
+    }
+    to = from + static_cast<TextPosition>(text.size());
+  }
+  auto mapped_str = m_editor.to_mapped_wstring(text);
+  mapped_str.mapping.add_offset(from);
+  if (to < length && !is_cut_at_line_break) {
+    // no line breaks in the whole chunk, word touching its end (possibly consisting of several camel case tokens)
+    // is moved to the next one unless it's the only word
+    auto word_begin = static_cast<TextPosition>(mapped_str.str.size());
+    while (word_begin > 0) {
+      auto token_begin = prev_token_begin(mapped_str.str, word_begin - 1);
+      if (next_token_end(mapped_str.str, token_begin) != word_begin)
+        break;
+      word_begin = token_begin;
+    }
+    if (word_begin > 0) {
+      to = mapped_str.to_original_index(word_begin);
+      mapped_str.str.resize(word_begin);
+      mapped_str.mapping.truncate(word_begin + 1);
+    }
+  }
 
-  return std::array{it->word_start, it->word_end};
+  m_editor.force_style_update(from, to);
+  for (auto &word : check_text(mapped_str, true))
+    if (!word.is_correct)
+      callback(word);
+  return to;
 }
 
-std::optional<std::array<TextPosition, 2>> SpellChecker::find_last_misspelling(const MappedWstring &text_to_check, TextPosition last_valid_position) const {
-  auto words_to_check = check_text(text_to_check);
-  using namespace std::ranges;
-  auto reversed = views::reverse(words_to_check);
-  auto it = find_if(reversed, [last_valid_position](const SpellerWordData &word_data) {
-    return !word_data.is_correct && word_data.word_end < last_valid_position;
+std::optional<std::array<TextPosition, 2>> SpellChecker::find_misspelling(const MappedWstring &text_to_check, CheckTextMode mode,
+                                                                         const std::function<bool(const SpellerWordData &word)> &is_candidate) const {
+  if (text_to_check.str.empty())
+    return std::nullopt;
+  RangeStyleInfo style_info(m_editor, text_to_check.to_original_index(0),
+                            text_to_check.to_original_index(static_cast<TextPosition>(text_to_check.str.size())));
+  auto &speller = m_speller_container.active_speller();
+  std::vector<SpellerWordData> batch;
+  std::vector<WordForSpeller> words_for_speller;
+  auto batch_size = min_check_batch_size;
+
+  auto check_batch = [&]() -> std::optional<std::array<TextPosition, 2>> {
+    words_for_speller.clear();
+    for (auto &word : batch)
+      words_for_speller.push_back(std::move(word.word_for_speller));
+    auto results = speller.check_words(words_for_speller);
+    for (size_t i = 0; i < results.size(); ++i)
+      if (!results[i])
+        return std::array{batch[i].word_start, batch[i].word_end};
+    batch.clear();
+    batch_size = std::min(batch_size * 2, max_check_batch_size);
+    return std::nullopt;
+  };
+
+  auto find_in = [&](auto tokens) -> std::optional<std::array<TextPosition, 2>> {
+    MappedWstring::Hint hint;
+    for (auto token : tokens) {
+      auto word = to_word_to_check(text_to_check, token, style_info, hint);
+      if (!word || !is_candidate(*word))
+        continue;
+      batch.push_back(std::move(*word));
+      if (batch.size() < batch_size)
+        continue;
+      if (auto result = check_batch())
+        return result;
+    }
+    return check_batch();
+  };
+
+  return m_settings.do_with_tokenizer(text_to_check.str, [&](const auto &tokenizer) -> std::optional<std::array<TextPosition, 2>> {
+    switch (mode) {
+    case CheckTextMode::find_first:
+      return find_in(tokenizer.tokens());
+    case CheckTextMode::find_last:
+      return find_in(tokenizer.reversed_tokens());
+    }
+    return std::nullopt;
   });
-  if (it == reversed.end())
-    return {};
+}
 
-  return std::array{it->word_start, it->word_end};
+std::optional<std::array<TextPosition, 2>> SpellChecker::find_first_misspelling(const MappedWstring &text_to_check, TextPosition last_valid_position) const {
+  return find_misspelling(text_to_check, CheckTextMode::find_first,
+                          [last_valid_position](const SpellerWordData &word) { return word.word_end > last_valid_position; });
+}
+
+std::optional<std::array<TextPosition, 2>> SpellChecker::find_last_misspelling(const MappedWstring &text_to_check, TextPosition last_valid_position) const {
+  return find_misspelling(text_to_check, CheckTextMode::find_last,
+                          [last_valid_position](const SpellerWordData &word) { return word.word_end < last_valid_position; });
 }
 
 void SpellChecker::check_visible() {
   print_to_log(L"void SpellChecker::check_visible(NppViewType view)", m_editor.get_editor_hwnd());
-  auto text = get_visible_text();
-  underline_misspelled_words(text);
+  auto ranges = get_visible_line_ranges();
+  if (ranges.empty())
+    return;
+  check_line_ranges(ranges, 0, ranges.back().to);
+}
+
+void SpellChecker::on_text_modified(TextPosition position, TextPosition length, bool is_insertion) {
+  // already recorded range is shifted to stay valid after modification
+  auto shift = [&](TextPosition pos) {
+    if (is_insertion)
+      return pos >= position ? pos + length : pos;
+    if (pos <= position)
+      return pos;
+    return pos >= position + length ? pos - length : position;
+  };
+  std::array<TextPosition, 2> modified_range{position, is_insertion ? position + length : position};
+  if (m_dirty_range) {
+    auto &range = *m_dirty_range;
+    modified_range = {std::min(shift(range[0]), modified_range[0]), std::max(shift(range[1]), modified_range[1])};
+  }
+  m_dirty_range = modified_range;
+
+  auto document = m_editor.get_full_current_path();
+  if (auto it = m_applied_underlines.find(document); it != m_applied_underlines.end())
+    it->second.on_text_modified(position, length, is_insertion);
+
+  if (!m_misspelling_index.is_empty()) {
+    if (m_misspelling_index.document() != document)
+      return reset_misspelling_index();
+    m_misspelling_index.on_text_modified(position, length, is_insertion);
+    if (m_misspelling_index.is_empty())
+      m_misspelling_index_task.cancel();
+  }
+}
+
+void SpellChecker::recheck_modified() {
+  if (!m_dirty_range)
+    return recheck_visible();
+
+  if (!m_speller_container.active_speller().is_working() ||
+      !SpellCheckerHelpers::is_spell_checking_needed_for_file(m_editor, m_settings))
+    return recheck_visible();
+
+  print_to_log(L"void SpellChecker::recheck_modified()", m_editor.get_editor_hwnd());
+  auto len = m_editor.get_active_document_length();
+  auto [dirty_start, dirty_end] = *std::exchange(m_dirty_range, std::nullopt);
+  dirty_start = std::clamp(dirty_start, 0_sz, len);
+  dirty_end = std::clamp(dirty_end, dirty_start, len);
+
+  auto top_visible_line = m_editor.get_first_visible_line();
+  auto top_visible_line_index = m_editor.get_document_line_from_visible(top_visible_line);
+  auto bottom_visible_line_index = m_editor.get_document_line_from_visible(top_visible_line + m_editor.get_lines_on_screen() - 1);
+  auto first_line = std::max<TextPosition>(m_editor.line_from_position(dirty_start), top_visible_line_index);
+  auto last_line = std::min<TextPosition>(m_editor.line_from_position(dirty_end), bottom_visible_line_index);
+  if (first_line > bottom_visible_line_index)
+    return; // modified text is below the screen, it will be checked after scrolling
+
+  // line breaks are delimiters for every tokenization style so whole lines are always bounded by tokens
+  std::vector<LineRange> ranges;
+  for (auto line = first_line; line <= last_line; ++line) {
+    if (!m_editor.is_line_visible(line))
+      continue;
+    auto line_start = m_editor.get_line_start_position(line);
+    ranges.push_back({line, line_start, line_start, m_editor.get_line_end_position(line)});
+  }
+  // modification could restyle the following lines (e.g. by opening a comment or a string), so the rest of the screen
+  // is checked too, lines which didn't change are taken from the line cache without asking the speller
+  for (auto &range : get_visible_line_ranges())
+    if (range.line > last_line)
+      ranges.push_back(range);
+
+  // underlines are cleared only over runs of visible lines, folded ones keep theirs since they aren't checked
+  size_t run_begin = 0;
+  for (size_t i = 1; i <= ranges.size(); ++i) {
+    if (i < ranges.size() && ranges[i].line == ranges[i - 1].line + 1)
+      continue;
+    check_line_ranges({ranges.begin() + run_begin, ranges.begin() + i}, ranges[run_begin].from, ranges[i - 1].to);
+    run_begin = i;
+  }
 }
 
 void SpellChecker::recheck_visible() {
+  m_dirty_range = std::nullopt;
   if (!m_speller_container.active_speller().is_working()) {
     clear_all_underlines();
     return;
@@ -454,38 +806,52 @@ void SpellChecker::recheck_visible() {
 }
 
 std::wstring SpellChecker::get_all_misspellings_as_string() const {
+  std::wstring str;
+  for (auto &entry : get_misspelling_report(MisspellingReportOrder::alphabetical))
+    str += entry.word + L'\n';
+  return str;
+}
+
+std::vector<MisspellingReportEntry> SpellChecker::get_misspelling_report(MisspellingReportOrder order) const {
   ACTIVE_VIEW_BLOCK(m_editor);
-  auto buf = m_editor.get_active_document_text();
-  auto mapped_str = m_editor.to_mapped_wstring(buf);
-  m_editor.force_style_update(mapped_str.mapping.front(), mapped_str.mapping.back());
-  auto misspelled_words = get_misspelled_words(mapped_str);
-  std::sort(misspelled_words.begin(), misspelled_words.end(), [](const auto &lhs, const auto &rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](wchar_t lhs, wchar_t rhs) {
-      return CharUpper(reinterpret_cast<LPWSTR>(lhs)) < CharUpper(reinterpret_cast<LPWSTR>(rhs));
-    });
+  std::vector<MisspellingReportEntry> entries;
+  // words are aggregated by their upper case form, so comparisons don't have to convert case of every character again
+  std::unordered_map<std::wstring, size_t> entry_index_by_folded_word;
+  std::wstring folded_word;
+  for_each_misspelling_in_document([&](const SpellerWordData &word) {
+    folded_word.resize(word.token.size());
+    std::transform(word.token.begin(), word.token.end(), folded_word.begin(), &make_upper);
+    auto [it, inserted] = entry_index_by_folded_word.try_emplace(folded_word, entries.size());
+    if (inserted)
+      entries.push_back({std::wstring(word.token), word.word_start, m_editor.line_from_position(word.word_start), 0});
+    ++entries[it->second].count;
   });
-  auto it = std::unique(misspelled_words.begin(), misspelled_words.end(), [](const auto &lhs, const auto &rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
-                      [](wchar_t lhs, wchar_t rhs) { return CharUpper(reinterpret_cast<LPWSTR>(lhs)) == CharUpper(reinterpret_cast<LPWSTR>(rhs)); });
-  });
-  misspelled_words.erase(it, misspelled_words.end());
+
+  switch (order) {
+  case MisspellingReportOrder::alphabetical: {
+    std::vector<std::pair<std::wstring_view, size_t>> sorted_words(entry_index_by_folded_word.begin(), entry_index_by_folded_word.end());
+    std::sort(sorted_words.begin(), sorted_words.end());
+    std::vector<MisspellingReportEntry> sorted_entries;
+    sorted_entries.reserve(entries.size());
+    for (auto index : sorted_words | std::views::values)
+      sorted_entries.push_back(std::move(entries[index]));
+    return sorted_entries;
+  }
+  case MisspellingReportOrder::by_frequency:
+    std::stable_sort(entries.begin(), entries.end(), [](const MisspellingReportEntry &lhs, const MisspellingReportEntry &rhs) { return lhs.count > rhs.count; });
+    return entries;
+  }
+  throw std::invalid_argument("get_misspelling_report: corrupted enum value for order");
+}
+
+std::wstring SpellChecker::get_misspelling_report_as_string() const {
   std::wstring str;
-  for (auto &s : misspelled_words)
-    str += std::wstring{s} + L'\n';
-  misspelled_words.clear();
+  for (auto &entry : get_misspelling_report(MisspellingReportOrder::by_frequency))
+    str += std::to_wstring(entry.count) + L'\t' + std::to_wstring(entry.first_line + 1) + L'\t' + entry.word + L'\n';
   return str;
 }
 
 void SpellChecker::mark_lines_with_misspelling() const {
   ACTIVE_VIEW_BLOCK(m_editor);
-  auto buf = m_editor.get_active_document_text();
-  auto mapped_str = m_editor.to_mapped_wstring(buf);
-  m_editor.force_style_update(mapped_str.mapping.front(), mapped_str.mapping.back());
-  auto misspelled_words = get_misspelled_words(mapped_str);
-  for (auto &misspelling : misspelled_words) {
-    auto start_index = misspelling.data() - mapped_str.str.data();
-    auto position = mapped_str.to_original_index(start_index);
-    auto line = m_editor.line_from_position(position);
-    m_editor.add_bookmark(line);
-  }
+  for_each_misspelling_in_document([&](const SpellerWordData &word) { m_editor.add_bookmark(m_editor.line_from_position(word.word_start)); });
 }
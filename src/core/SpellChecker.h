@@ -15,6 +15,10 @@
 #pragma once
 // Class that will do most of the job with spellchecker
 
+#include "AppliedUnderlines.h"
+#include "LineCache.h"
+#include "MisspellingIndex.h"
+#include "common/TaskWrapper.h"
 #include "npp/EditorInterface.h"
 
 
@@ -32,6 +36,21 @@ class NativeSpellerInterface;
 class WordForSpeller;
 class SpellerContainer;
 class SpellerWordData;
+class LineRange;
+class RangeStyleInfo;
+
+// Unique misspelling of the document, words differing only by case are counted together
+struct MisspellingReportEntry {
+  std::wstring word; // as written at the first occurrence
+  TextPosition first_position;
+  int first_line;
+  size_t count;
+};
+
+enum class MisspellingReportOrder {
+  alphabetical, // case-insensitive
+  by_frequency, // most frequent first, ties in the order of the first occurrence
+};
 
 class SpellChecker {
   enum class CheckTextMode {
@@ -45,9 +64,20 @@ public:
   ~SpellChecker();
   void recheck_visible_both_views();
   void recheck_visible();
+  // Records text modification so the next recheck_modified() could limit itself to touched lines
+  void on_text_modified(TextPosition position, TextPosition length, bool is_insertion);
+  // Rechecks only visible lines touched since the last pass, falls back to recheck_visible() if nothing was recorded
+  void recheck_modified();
 
   std::wstring get_all_misspellings_as_string() const;
+  std::vector<MisspellingReportEntry> get_misspelling_report(MisspellingReportOrder order) const;
+  // Lines of tab-separated count, 1-based line of the first occurrence and word, most frequent first
+  std::wstring get_misspelling_report_as_string() const;
   void on_settings_changed();
+  // Drops everything remembered about the document
+  void on_document_closed(const std::wstring &document);
+  // Should be called when indicators of the current document change, underlines changed by anyone else are reapplied on the next pass
+  void on_indicator_changed(TextPosition position, TextPosition length);
   void find_next_mistake();
   void find_prev_mistake();
   WordForSpeller to_word_for_speller(std::wstring_view word) const;
@@ -56,27 +86,50 @@ public:
                                     bool use_text_cursor = false) const;
   void erase_all_misspellings();
   void mark_lines_with_misspelling() const;
+  const LineCache &line_cache() const { return m_line_cache; }
 
 private:
-  void create_word_underline(TextPosition start, TextPosition end) const;
-  void remove_underline(TextPosition start, TextPosition end) const;
-  void clear_all_underlines() const;
+  AppliedUnderlines &applied_underlines(const std::wstring &document);
+  void clear_all_underlines();
   bool check_word(std::wstring_view word,
                   TextPosition word_start) const;
   TextPosition prev_token_begin_in_document(TextPosition start) const;
   TextPosition next_token_end_in_document(TextPosition end) const;
-  MappedWstring get_visible_text();
-  std::vector<SpellerWordData> check_text(const MappedWstring &text_to_check) const;
-  void underline_misspelled_words(const MappedWstring &text_to_check) const;
-  std::vector<std::wstring_view> get_misspelled_words(const MappedWstring &text_to_check) const;
+  std::vector<LineRange> get_visible_line_ranges();
+  // in_parallel allows speller to use several threads which makes sense only for big texts
+  std::vector<SpellerWordData> check_text(const MappedWstring &text_to_check, bool in_parallel = false) const;
+  std::vector<SpellerWordData> check_text(const MappedWstring &text_to_check, const RangeStyleInfo &style_info, bool in_parallel = false) const;
+  // Checks line ranges which are not cached yet and underlines misspellings of all of them within [from, to)
+  void check_line_ranges(const std::vector<LineRange> &ranges, TextPosition from, TextPosition to);
+  // Sends only operations which change underlines compared to the last pass
+  void underline_misspellings(const std::wstring &document, const LineCache::Misspellings &misspellings, TextPosition from, TextPosition to);
+  // Checks the whole document by chunks of limited size, so memory usage doesn't depend on document size
+  void for_each_misspelling_in_document(const std::function<void(const SpellerWordData &word)> &callback) const;
+  // Checks a chunk starting at `from` which is at most `max_length` long and ends at a word boundary, returns its end
+  TextPosition for_each_misspelling_in_chunk(TextPosition from, TextPosition max_length,
+                                             const std::function<void(const SpellerWordData &word)> &callback) const;
+  // Returns nullopt if token doesn't need to be checked
+  // `hint` speeds up position lookups for tokens going forward
+  std::optional<SpellerWordData> to_word_to_check(const MappedWstring &text, std::wstring_view token, const RangeStyleInfo &style_info,
+                                                  MappedWstring::Hint &hint) const;
   std::optional<std::array<TextPosition, 2>> find_first_misspelling(const MappedWstring &text_to_check, TextPosition last_valid_position) const;
   std::optional<std::array<TextPosition, 2>> find_last_misspelling(const MappedWstring &text_to_check, TextPosition last_valid_position) const;
+  // Checks tokens lazily in small batches in the order of `mode` and stops at the first misspelled word satisfying `is_candidate`
+  std::optional<std::array<TextPosition, 2>> find_misspelling(const MappedWstring &text_to_check, CheckTextMode mode,
+                                                             const std::function<bool(const SpellerWordData &word)> &is_candidate) const;
   void check_visible();
+  // Returns false if index isn't built for the current document yet (building is started then if it makes sense)
+  bool find_mistake_using_index(bool next);
+  void start_misspelling_index_building();
+  void continue_misspelling_index_building(TextPosition offset);
+  void recheck_misspelling_index_dirty_ranges();
+  void reset_misspelling_index();
 
   std::wstring_view get_word_at(TextPosition char_pos, const MappedWstring &text) const;
   void refresh_underline_style();
   bool is_spellchecking_needed(std::wstring_view word,
                                TextPosition word_start) const;
+  bool is_spellchecking_needed(std::wstring_view word, TextPosition word_start, const RangeStyleInfo &style_info) const;
   TextPosition next_token_end(std::wstring_view target, TextPosition index) const;
   TextPosition prev_token_begin(std::wstring_view target, TextPosition index) const;
 
@@ -85,4 +138,13 @@ private:
 
   EditorInterface &m_editor;
   const SpellerContainer &m_speller_container;
+  std::optional<std::array<TextPosition, 2>> m_dirty_range;
+  LineCache m_line_cache;
+  std::unordered_map<std::wstring, AppliedUnderlines> m_applied_underlines;
+  // view index -> document underlined there last time, asking the editor for the path on every indicator change is costly
+  std::unordered_map<int, std::wstring> m_underlined_documents;
+  // set while our own underline operations are sent, editor reports them synchronously
+  bool m_is_applying_underlines = false;
+  MisspellingIndex m_misspelling_index;
+  TaskWrapper m_misspelling_index_task;
 };
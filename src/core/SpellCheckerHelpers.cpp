@@ -16,6 +16,7 @@
 
 #include "common/string_utils.h"
 #include "common/Utility.h"
+#include "core/RangeStyleInfo.h"
 #include "core/SpellChecker.h"
 #include "npp/EditorInterface.h"
 #include "npp/ScintillaUtils.h"
@@ -142,13 +143,7 @@ void replace_all_tokens(EditorInterface &editor, const Settings &settings, const
   }
 }
 
-bool is_word_spell_checking_needed(const Settings &settings, const EditorInterface &editor, std::wstring_view word,
-                                   TextPosition word_start) {
-  if (word.empty())
-    return false;
-
-  auto style = editor.get_style_at(word_start);
-  auto lexer = editor.get_lexer();
+static bool is_style_spell_checking_needed(const Settings &settings, int lexer, int style) {
   auto category = ScintillaUtils::get_style_category(lexer, style, settings);
   if (category == ScintillaUtils::StyleCategory::unknown) {
     return false;
@@ -161,10 +156,26 @@ bool is_word_spell_checking_needed(const Settings &settings, const EditorInterfa
     return false;
   }
 
+  return true;
+}
+
+bool is_position_spell_checking_needed(const Settings &settings, const EditorInterface &editor, TextPosition word_start) {
+  if (!is_style_spell_checking_needed(settings, editor.get_lexer(), editor.get_style_at(word_start)))
+    return false;
+
   // ignoring URLs new style:
   if (editor.get_indicator_value_at(URL_INDIC, word_start) != 0)
     return false;
 
+  return true;
+}
+
+bool is_position_spell_checking_needed(const Settings &settings, const RangeStyleInfo &style_info, TextPosition word_start) {
+  return is_style_spell_checking_needed(settings, style_info.lexer(), style_info.style_at(word_start)) && !style_info.is_url_at(word_start);
+}
+
+// Conditions which depend only on the word itself
+static bool is_word_content_spell_checking_needed(const Settings &settings, std::wstring_view word) {
   if (static_cast<int>(word.length()) < settings.data.word_minimum_length)
     return false;
 
@@ -175,14 +186,14 @@ bool is_word_spell_checking_needed(const Settings &settings, const EditorInterfa
       std::find_if(word.begin(), word.end(), [](wchar_t wc) { return IsCharAlphaNumeric(wc) && !IsCharAlpha(wc); }) != word.end())
     return false;
 
-  if (settings.data.ignore_starting_with_capital && IsCharUpper(word.front())) {
+  if (settings.data.ignore_starting_with_capital && is_upper(word.front())) {
     return false;
   }
 
   if (settings.data.ignore_having_a_capital || settings.data.ignore_all_capital) {
-    bool all_upper = IsCharUpper(word.front()), any_upper = false;
+    bool all_upper = is_upper(word.front()), any_upper = false;
     for (auto c : std::wstring_view(word).substr(1)) {
-      if (IsCharUpper(c)) {
+      if (is_upper(c)) {
         any_upper = true;
       } else
         all_upper = false;
@@ -203,19 +214,28 @@ bool is_word_spell_checking_needed(const Settings &settings, const EditorInterfa
       return false;
   }
 
-  if (const auto regexp_ptr = settings.get_ignore_regexp ())
-    if (std::regex_match(word.begin (), word.end (), *regexp_ptr))
-      return false;
+  if (settings.matches_ignore_regexp(word))
+    return false;
 
   return true;
 }
 
+bool is_word_spell_checking_needed(const Settings &settings, const EditorInterface &editor, std::wstring_view word,
+                                   TextPosition word_start) {
+  return !word.empty() && is_position_spell_checking_needed(settings, editor, word_start) && is_word_content_spell_checking_needed(settings, word);
+}
+
+bool is_word_spell_checking_needed(const Settings &settings, const RangeStyleInfo &style_info, std::wstring_view word,
+                                   TextPosition word_start) {
+  return !word.empty() && is_position_spell_checking_needed(settings, style_info, word_start) && is_word_content_spell_checking_needed(settings, word);
+}
+
 void replace_current_word_with_topmost_suggestion(EditorInterface &editor, const SpellChecker &spell_checker, const SpellerContainer &speller_container) {
   TextPosition pos, length;
   if (!spell_checker.is_word_under_cursor_correct(pos, length, true)) {
     ACTIVE_VIEW_BLOCK(editor);
     const auto wstr = editor.get_mapped_wstring_range(pos, pos + length);
-    const auto suggestions = speller_container.active_speller().get_suggestions(wstr.str.c_str());
+    const auto suggestions = speller_container.get_suggestions(wstr.str);
     if (!suggestions.empty()) {
       const auto converted_suggestion = editor.to_editor_encoding(suggestions.front());
       editor.replace_text(pos, pos + length, converted_suggestion);
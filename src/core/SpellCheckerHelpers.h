@@ -16,6 +16,7 @@
 
 class Settings;
 class EditorInterface;
+class RangeStyleInfo;
 class SpellerContainer;
 enum class NppViewType;
 
@@ -29,6 +30,11 @@ void cut_apostrophes(const Settings &settings, std::wstring_view &word);
 // If to is proper name or abbreviation it should be capitalized correctly otherwise it should be all lower case
 void replace_all_tokens(EditorInterface &editor, const Settings &settings, const char *from, std::wstring_view to, bool
                         is_proper_name);
+// Checks only style and indicator based conditions for the word starting at `word_start`
+bool is_position_spell_checking_needed(const Settings &settings, const EditorInterface &editor, TextPosition word_start);
+bool is_position_spell_checking_needed(const Settings &settings, const RangeStyleInfo &style_info, TextPosition word_start);
 bool is_word_spell_checking_needed(const Settings &settings, const EditorInterface &editor, std::wstring_view word, TextPosition word_start);
+// Same as above but styles and indicators are taken from data fetched beforehand, `word_start` should be within its range
+bool is_word_spell_checking_needed(const Settings &settings, const RangeStyleInfo &style_info, std::wstring_view word, TextPosition word_start);
 void replace_current_word_with_topmost_suggestion(EditorInterface &editor, const SpellChecker &spell_checker, const SpellerContainer &speller_container);
 } // namespace SpellCheckerHelpers
@@ -31,7 +31,7 @@ TextPosition EditorInterface::get_prev_valid_begin_pos(TextPosition pos) const {
     return pos - 1;
 
   auto worst_prev_pos = std::max(0_sz, pos - static_cast<TextPosition>(max_utf8_char_length));
-  auto rng = get_text_range(worst_prev_pos, pos);
+  auto rng = get_text_range_view(worst_prev_pos, pos);
   auto it = std::find_if(rng.rbegin(), rng.rend(), &utf8_is_lead);
   assert(it != rng.rend ());
   return worst_prev_pos + (it.base() - rng.begin()) - 1;
@@ -45,8 +45,8 @@ TextPosition EditorInterface::get_next_valid_end_pos(TextPosition pos) const {
   if (get_encoding() == EditorCodepage::ansi)
     return pos + 1;
 
-  auto text = get_text_range(pos, pos + 1);
-  return pos + utf8_symbol_len(*text.begin());
+  auto text = get_text_range_view(pos, pos + 1);
+  return pos + utf8_symbol_len(text.front());
 }
 
 std::string EditorInterface::to_editor_encoding(std::wstring_view str) const {
@@ -61,7 +61,7 @@ std::string EditorInterface::to_editor_encoding(std::wstring_view str) const {
   throw std::runtime_error("Unsupported encoding");
 }
 
-MappedWstring EditorInterface::to_mapped_wstring(const std::string &str) {
+MappedWstring EditorInterface::to_mapped_wstring(std::string_view str) {
   if (get_encoding() == EditorCodepage::utf8)
     return utf8_to_mapped_wstring(str);
 
@@ -69,16 +69,13 @@ MappedWstring EditorInterface::to_mapped_wstring(const std::string &str) {
 }
 
 MappedWstring EditorInterface::get_mapped_wstring_range(TextPosition from, TextPosition to) {
-  auto result = to_mapped_wstring(get_text_range(from, to));
-  for (auto &val : result.mapping)
-    val += from;
+  auto result = to_mapped_wstring(get_text_range_view(from, to));
+  result.mapping.add_offset(from);
   return result;
 }
 
 MappedWstring EditorInterface::get_mapped_wstring_line(TextPosition line) {
   auto result = to_mapped_wstring(get_line(line));;
-  auto line_start = get_line_start_position(line);
-  for (auto &val : result.mapping)
-    val += line_start;
+  result.mapping.add_offset(get_line_start_position(line));
   return result;
 }
@@ -103,11 +103,18 @@ public:
   virtual HWND get_view_hwnd() const = 0;
   virtual int get_style_at(TextPosition position) const = 0;
   virtual int get_indicator_value_at(int indicator_id, TextPosition position) const = 0;
+  // Bulk versions of the two above for the whole range [from, to)
+  virtual std::vector<int> get_styles(TextPosition from, TextPosition to) const = 0;
+  // Returns sorted runs [start, end) where indicator value is non-zero, clipped to the range
+  virtual std::vector<std::array<TextPosition, 2>> get_indicator_runs(int indicator_id, TextPosition from, TextPosition to) const = 0;
   virtual std::wstring get_full_current_path() const = 0;
   // is current style used for links (hotspots):
   virtual TextPosition get_active_document_length() const = 0;
   virtual std::string get_text_range(TextPosition from,
                                      TextPosition to) const = 0;
+  // Points directly to editor memory, no copies made. Valid only until the next modification of the document
+  virtual std::string_view get_text_range_view(TextPosition from,
+                                               TextPosition to) const = 0;
   virtual TextPosition get_line_length(int line) const = 0;
   virtual int get_point_x_from_position(
       TextPosition position) const = 0;
@@ -130,7 +137,7 @@ public:
 
   TextPosition get_prev_valid_begin_pos(TextPosition pos) const;
   TextPosition get_next_valid_end_pos(TextPosition pos) const;
-  MappedWstring to_mapped_wstring(const std::string &str);
+  MappedWstring to_mapped_wstring(std::string_view str);
   MappedWstring get_mapped_wstring_range(TextPosition from, TextPosition to);
   MappedWstring get_mapped_wstring_line(TextPosition line);
   std::string to_editor_encoding(std::wstring_view str) const;
@@ -53,6 +53,36 @@ int NppInterface::get_indicator_value_at(int indicator_id, TextPosition position
   return static_cast<int>(send_msg_to_scintilla(SCI_INDICATORVALUEAT, indicator_id, position));
 }
 
+std::vector<int> NppInterface::get_styles(TextPosition from, TextPosition to) const {
+  if (from >= to)
+    return {};
+  Sci_TextRange range;
+  range.chrg.cpMin = static_cast<Sci_PositionCR>(from);
+  range.chrg.cpMax = static_cast<Sci_PositionCR>(to);
+  // characters and styles are interleaved, followed by two terminating zeroes
+  std::vector<char> buf((to - from) * 2 + 2);
+  range.lpstrText = buf.data();
+  send_msg_to_scintilla(SCI_GETSTYLEDTEXT, 0, reinterpret_cast<LPARAM>(&range));
+  std::vector<int> styles(to - from);
+  for (size_t i = 0; i < styles.size(); ++i)
+    styles[i] = static_cast<unsigned char>(buf[i * 2 + 1]);
+  return styles;
+}
+
+std::vector<std::array<TextPosition, 2>> NppInterface::get_indicator_runs(int indicator_id, TextPosition from, TextPosition to) const {
+  std::vector<std::array<TextPosition, 2>> runs;
+  auto pos = from;
+  while (pos < to) {
+    auto end = static_cast<TextPosition>(send_msg_to_scintilla(SCI_INDICATOREND, indicator_id, pos));
+    if (end <= pos)
+      end = to;
+    if (get_indicator_value_at(indicator_id, pos) != 0)
+      runs.push_back({pos, std::min(end, to)});
+    pos = end;
+  }
+  return runs;
+}
+
 LRESULT NppInterface::send_msg_to_npp(UINT Msg, WPARAM wParam, LPARAM lParam) const { return SendMessage(m_npp_data.npp_handle, Msg, wParam, lParam); }
 
 HWND NppInterface::get_view_hwnd() const {
@@ -145,6 +175,15 @@ std::wstring NppInterface::active_document_path() const { return get_dir_msg(NPP
 
 void NppInterface::switch_to_file(const std::wstring &path) { send_msg_to_npp(NPPM_SWITCHTOFILE, 0, reinterpret_cast<LPARAM>(path.data())); }
 
+std::wstring NppInterface::get_full_path_from_buffer_id(UINT_PTR buffer_id) const {
+  auto length = send_msg_to_npp(NPPM_GETFULLPATHFROMBUFFERID, buffer_id, 0);
+  if (length < 0)
+    return {};
+  std::vector<wchar_t> buf(length + 1);
+  send_msg_to_npp(NPPM_GETFULLPATHFROMBUFFERID, buffer_id, reinterpret_cast<LPARAM>(buf.data()));
+  return buf.data();
+}
+
 std::wstring NppInterface::active_file_directory() const { return get_dir_msg(NPPM_GETCURRENTDIRECTORY); }
 
 void NppInterface::do_command(int id) { send_msg_to_npp(WM_COMMAND, id); }
@@ -295,6 +334,8 @@ std::string NppInterface::get_line(TextPosition line_number) const {
 
 void NppInterface::move_active_document_to_other_view() { do_command(IDM_VIEW_GOTO_ANOTHER_VIEW); }
 
+void NppInterface::new_document() { do_command(IDM_FILE_NEW); }
+
 void NppInterface::add_toolbar_icon(int cmdId, const toolbarIconsWithDarkMode *toolBarIconsPtr) {
   send_msg_to_npp(NPPM_ADDTOOLBARICON_FORDARKMODE, static_cast<WPARAM>(cmdId), reinterpret_cast<LPARAM>(toolBarIconsPtr));
 }
@@ -373,6 +414,18 @@ std::string NppInterface::get_text_range(TextPosition from, TextPosition to) con
   return buf.data();
 }
 
+std::string_view NppInterface::get_text_range_view(TextPosition from, TextPosition to) const {
+  if (from >= to) {
+    assert(from == to); // Incorrect request to Scintilla. Prevent possible crash.
+    return {};
+  }
+  // Scintilla moves the gap out of the range if needed, so it is contiguous
+  auto ptr = reinterpret_cast<const char *>(send_msg_to_scintilla(SCI_GETRANGEPOINTER, from, to - from));
+  if (ptr == nullptr)
+    return {};
+  return {ptr, static_cast<size_t>(to - from)};
+}
+
 void NppInterface::force_style_update(TextPosition from, TextPosition to) { send_msg_to_scintilla(SCI_COLOURISE, from, to); }
 
 std::vector<std::wstring> NppInterface::get_open_filenames_helper(int enum_val, int msg) const {
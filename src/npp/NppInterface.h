@@ -81,6 +81,7 @@ public:
   int get_style_at(TextPosition position) const override;
   TextPosition get_active_document_length() const override;
   std::string get_text_range(TextPosition from, TextPosition to) const override;
+  std::string_view get_text_range_view(TextPosition from, TextPosition to) const override;
   void force_style_update(TextPosition from, TextPosition to) override;
   std::optional<TextPosition> char_position_from_global_point(int x, int y) const override;
   TextPosition char_position_from_point(const POINT &pnt) const override;
@@ -107,8 +108,13 @@ public:
   void set_target_view(int view_index) const override;
 
   HMENU get_menu_handle(int menu_type) const;
+  std::wstring get_full_path_from_buffer_id(UINT_PTR buffer_id) const;
+  // Opens new empty document in the active view and activates it
+  void new_document();
   int get_target_view() const override;
   int get_indicator_value_at(int indicator_id, TextPosition position) const override;
+  std::vector<int> get_styles(TextPosition from, TextPosition to) const override;
+  std::vector<std::array<TextPosition, 2>> get_indicator_runs(int indicator_id, TextPosition from, TextPosition to) const override;
   HWND get_view_hwnd() const override;
   std::wstring get_editor_directory() const override;
 
@@ -3,35 +3,124 @@
 #include "common/Utility.h"
 #include "common/utf8.h"
 
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTF8_DECODE_SSE2
+#endif
+
+namespace {
+constexpr wchar_t replacement_character = 0xFFFD;
+
+// Widens ASCII prefix of `bytes` to `out`, returns its length
+size_t copy_ascii_prefix(const unsigned char *bytes, size_t length, wchar_t *out) {
+  size_t i = 0;
+#if defined(UTF8_DECODE_SSE2)
+  if constexpr (sizeof(wchar_t) == 2) {
+    const auto zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16) {
+      const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+      if (_mm_movemask_epi8(block) != 0)
+        break;
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_unpacklo_epi8(block, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i + 8), _mm_unpackhi_epi8(block, zero));
+    }
+  }
+#endif
+  for (; i < length && bytes[i] < 0x80; ++i)
+    out[i] = static_cast<wchar_t>(bytes[i]);
+  return i;
+}
+
+struct DecodedCharacter {
+  char32_t code_point;
+  size_t length;
+};
+
+// Decodes character starting with non-ASCII byte. Each maximal invalid subpart of a sequence is decoded as U+FFFD,
+// as recommended by the Unicode standard, so invalid bytes never swallow valid characters after them.
+DecodedCharacter decode_non_ascii(const unsigned char *bytes, size_t length) {
+  const auto lead = bytes[0];
+  size_t sequence_length = 0;
+  char32_t code_point = 0;
+  // ranges of the second byte exclude overlong forms, surrogates and values above U+10FFFF
+  unsigned char second_min = 0x80;
+  unsigned char second_max = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    sequence_length = 2;
+    code_point = static_cast<char32_t>(lead & 0x1F);
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    sequence_length = 3;
+    code_point = static_cast<char32_t>(lead & 0x0F);
+    if (lead == 0xE0)
+      second_min = 0xA0;
+    else if (lead == 0xED)
+      second_max = 0x9F;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    sequence_length = 4;
+    code_point = static_cast<char32_t>(lead & 0x07);
+    if (lead == 0xF0)
+      second_min = 0x90;
+    else if (lead == 0xF4)
+      second_max = 0x8F;
+  } else
+    return {replacement_character, 1};
+
+  for (size_t i = 1; i < sequence_length; ++i) {
+    if (i == length)
+      return {replacement_character, i};
+    const auto byte = bytes[i];
+    if (byte < (i == 1 ? second_min : 0x80) || byte > (i == 1 ? second_max : 0xBF))
+      return {replacement_character, i};
+    code_point = (code_point << 6) | (byte & 0x3F);
+  }
+  return {code_point, sequence_length};
+}
+} // namespace
+
 MappedWstring utf8_to_mapped_wstring(std::string_view str) {
   if (str.empty())
     return {};
-  ptrdiff_t len = str.length();
-  std::vector<wchar_t> buf;
-  std::vector<TextPosition> mapping;
-  buf.reserve(len);
-  mapping.reserve(len);
-  auto it = str.data();
+  const auto bytes = reinterpret_cast<const unsigned char *>(str.data());
+  const auto length = str.length();
+  MappedWstring result;
+  // every character takes at least as many bytes as UTF-16 code units
+  result.str.resize(length);
+  auto out = result.str.data();
+  size_t out_length = 0;
+  size_t pos = 0;
   // sadly this garbage skipping is required due to bad find prev mistake algorithm
-  while (utf8_is_cont(*it))
-    ++it;
-  size_t char_cnt = 1;
-  while (it - str.data() < len) {
-    auto next = utf8_inc(it);
-    buf.resize(char_cnt);
-    MultiByteToWideChar(CP_UTF8, 0, it, static_cast<int>(next - it), buf.data() + char_cnt - 1, 1);
-    mapping.push_back(it - str.data());
-    ++char_cnt;
-    it = next;
+  while (pos < length && utf8_is_cont(str[pos]))
+    ++pos;
+  while (pos < length) {
+    const auto ascii_length = copy_ascii_prefix(bytes + pos, length - pos, out + out_length);
+    if (ascii_length > 0) {
+      result.mapping.push_back_run(static_cast<TextPosition>(pos), static_cast<TextPosition>(ascii_length), 1);
+      pos += ascii_length;
+      out_length += ascii_length;
+      continue;
+    }
+
+    const auto character = decode_non_ascii(bytes + pos, length - pos);
+    result.mapping.push_back(static_cast<TextPosition>(pos));
+    pos += character.length;
+    if constexpr (sizeof(wchar_t) == 2) {
+      if (character.code_point >= 0x10000) {
+        // both surrogates are mapped to the start of the character
+        result.mapping.push_back(static_cast<TextPosition>(pos - character.length));
+        out[out_length++] = static_cast<wchar_t>(0xD800 + ((character.code_point - 0x10000) >> 10));
+        out[out_length++] = static_cast<wchar_t>(0xDC00 + ((character.code_point - 0x10000) & 0x3FF));
+        continue;
+      }
+    }
+    out[out_length++] = static_cast<wchar_t>(character.code_point);
   }
-  mapping.push_back(it - str.data());
-  return {std::wstring{buf.begin(), buf.end()}, std::move(mapping)};
+  result.mapping.push_back(static_cast<TextPosition>(pos));
+  result.str.resize(out_length);
+  return result;
 }
 
 MappedWstring to_mapped_wstring(std::string_view str) {
   if (str.empty())
     return {};
-  std::vector<TextPosition> mapping(str.length() + 1);
-  std::iota(mapping.begin(), mapping.end(), 0);
-  return {to_wstring(str), std::move(mapping)};
+  return {to_wstring(str), RunLengthMapping<TextPosition>::identity(static_cast<TextPosition>(str.length()) + 1)};
 }
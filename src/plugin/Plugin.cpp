@@ -235,6 +235,15 @@ void copy_misspellings_to_clipboard() {
   CloseClipboard();
 }
 
+void show_misspelling_report() {
+  if (!check_if_any_language_available())
+    return;
+  auto str = rc_str(IDS_MISSPELLING_REPORT_HEADER) + L'\n' + spell_checker->get_misspelling_report_as_string();
+  npp->new_document();
+  ACTIVE_VIEW_BLOCK(*npp);
+  npp->replace_text(0, 0, npp->to_editor_encoding(str));
+}
+
 void mark_lines_with_misspelling() {
   if (!check_if_any_language_available())
     return;
@@ -281,6 +290,12 @@ static void recheck_visible() {
   spell_checker->recheck_visible();
 }
 
+// suggestions requested in background for the word under the button are not needed once it's hidden
+static void hide_suggestions_button() {
+  suggestions_button->display(false);
+  speller_container->active_speller().cancel_suggestions_request();
+}
+
 void find_next_mistake() {
   if (!check_if_any_language_available())
     return;
@@ -381,6 +396,7 @@ static void command_menu_init() {
 
   action_index[Action::ignore_for_current_session] = set_next_command(rc_str(IDS_IGNORE_WORD_AT_CURSOR).c_str(), ignore_for_current_session);
   action_index[Action::mark_lines_with_misspelling] = set_next_command(rc_str(IDS_BOOKMARK_LINES_WITH_MISSPELLING).c_str(), mark_lines_with_misspelling);
+  action_index[Action::misspelling_report] = set_next_command(rc_str(IDS_MISSPELLING_REPORT).c_str(), show_misspelling_report);
   // add further set_next_command at the bottom to avoid breaking configured hotkeys
 }
 
@@ -514,7 +530,7 @@ void rearrange_menu() {
   auto plugin_menu = get_this_plugin_menu();
   auto submenu = CreatePopupMenu();
   auto list = {
-      Action::copy_all_misspellings, Action::erase_all_misspellings, Action::mark_lines_with_misspelling,
+      Action::copy_all_misspellings, Action::misspelling_report, Action::erase_all_misspellings, Action::mark_lines_with_misspelling,
       Action::replace_with_1st_suggestion, Action::ignore_for_current_session,
       Action::show_spell_check_menu_at_cursor, Action::reload_user_dictionaries, Action::toggle_debug_logging, Action::open_debug_log};
   for (auto action : list) {
@@ -624,11 +640,11 @@ LRESULT CALLBACK subclass_proc(HWND h_wnd, UINT message, WPARAM w_param, LPARAM
   case WM_CONTEXTMENU:
     last_hwnd = w_param;
     last_coords = l_param;
-    suggestions_button->display(false);
+    hide_suggestions_button();
     context_menu_handler->precalculate_menu();
     return TRUE;
   case WM_DISPLAYCHANGE: {
-    suggestions_button->display(false);
+    hide_suggestions_button();
   }
   break;
   }
@@ -701,7 +717,7 @@ void WINAPI edit_recheck_callback() {
   edit_recheck_timer->stop_timer();
 
   ACTIVE_VIEW_BLOCK(npp_interface());
-  spell_checker->recheck_visible();
+  spell_checker->recheck_modified();
   if (!first_restyle)
     restyling_caused_recheck_was_done = true;
   first_restyle = false;
@@ -797,6 +813,12 @@ extern "C" __declspec(dllexport) void beNotified(SCNotification *notify_code) {
   }
   break;
 
+  case NPPN_FILEBEFORECLOSE:
+    if (!spell_checker)
+      return;
+    spell_checker->on_document_closed(npp->get_full_path_from_buffer_id(notify_code->nmhdr.idFrom));
+    break;
+
   case SCN_FOLDINGSTATECHANGED:
     update_on_visible_area_changed();
     break;
@@ -818,7 +840,7 @@ extern "C" __declspec(dllexport) void beNotified(SCNotification *notify_code) {
       update_on_visible_area_changed();
     }
     if (!suggestions_button->is_pressed())
-      suggestions_button->display(false);
+      hide_suggestions_button();
     break;
 
   case SCN_ZOOM:
@@ -828,8 +850,20 @@ extern "C" __declspec(dllexport) void beNotified(SCNotification *notify_code) {
   case SCN_MODIFIED:
     if (!spell_checker)
       return;
-    if (edit_recheck_timer && (notify_code->modificationType & (SC_MOD_DELETETEXT | SC_MOD_INSERTTEXT)) != 0) {
-      edit_recheck_timer->set_resolution(std::chrono::milliseconds(get_settings().data.recheck_delay));
+    if ((notify_code->modificationType & (SC_MOD_DELETETEXT | SC_MOD_INSERTTEXT)) != 0) {
+      {
+        ACTIVE_VIEW_BLOCK(npp_interface());
+        // the same document could be opened in both views, recording modification only once
+        if (notify_code->nmhdr.hwndFrom == npp->get_view_hwnd())
+          spell_checker->on_text_modified(notify_code->position, notify_code->length, (notify_code->modificationType & SC_MOD_INSERTTEXT) != 0);
+      }
+      if (edit_recheck_timer)
+        edit_recheck_timer->set_resolution(std::chrono::milliseconds(get_settings().data.recheck_delay));
+    }
+    if ((notify_code->modificationType & SC_MOD_CHANGEINDICATOR) != 0) {
+      ACTIVE_VIEW_BLOCK(npp_interface());
+      if (notify_code->nmhdr.hwndFrom == npp->get_view_hwnd())
+        spell_checker->on_indicator_changed(notify_code->position, notify_code->length);
     }
     break;
 
@@ -932,7 +966,7 @@ messageProc(UINT message, WPARAM w_param, LPARAM l_param) {
   switch (message) {
   case WM_MOVE:
     if (suggestions_button)
-      suggestions_button->display(false);
+      hide_suggestions_button();
     return FALSE;
   case WM_COMMAND: {
     if (HIWORD(w_param) == 0 && get_use_allocated_ids()) {
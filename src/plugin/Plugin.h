@@ -42,6 +42,7 @@ enum class Action {
   about,
   find_next_error,
   find_prev_error,
+  misspelling_report,
 
   COUNT,
 };
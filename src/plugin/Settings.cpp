@@ -23,6 +23,9 @@
 
 #include <cassert>
 
+// results of std::wregex matching are cached for that many words
+constexpr size_t max_cached_ignore_regexp_result_count = 65536;
+
 const wchar_t *default_delimiters() {
   return L",.!?\":;{}()[]\\/"
       L"=+-^$*<>|#$@%&~"
@@ -69,6 +72,8 @@ std::wstring gui_string(TokenizationStyle value) {
     return rc_str(IDS_SPLIT_WORDS_BY_DELIMS);
   case TokenizationStyle::by_non_ansi:
     return rc_str(IDS_SPLIT_WORDS_BY_NON_ANSI);
+  case TokenizationStyle::by_word_boundaries:
+    return rc_str(IDS_SPLIT_WORDS_BY_WORD_BOUNDARIES);
   case TokenizationStyle::COUNT:
     break;
   }
@@ -132,10 +137,52 @@ static const wchar_t *default_language(SpellerId value) {
 Settings::Settings(std::wstring_view ini_filepath)
   : m_ini_filepath(ini_filepath) {
   settings_changed.connect([this] { on_settings_changed(); });
+  update_cached_values();
 }
 
-const std::wregex *Settings::get_ignore_regexp() const {
-  return std::get_if<std::wregex> (&data.ignore_regexp);
+bool Settings::is_delimiter(wchar_t c) const {
+  switch (data.tokenization_style) {
+  case TokenizationStyle::by_non_alphabetic:
+    return !IsCharAlphaNumeric(c) && data.delimiter_exclusions.find(c) == std::wstring_view::npos;
+  case TokenizationStyle::by_non_ansi: {
+    static const auto ansi_str = []() {
+      constexpr auto char_cnt = 256;
+      std::string s;
+      for (int i = 1; i < char_cnt; ++i)
+        s.push_back(static_cast<char>(i));
+      auto ws = to_wstring(s);
+      std::erase_if(ws, [](wchar_t c) { return !IsCharAlphaNumeric(c); });
+      std::sort(ws.begin(), ws.end());
+      return ws;
+    }();
+    return !std::binary_search(ansi_str.begin(), ansi_str.end(), c) && data.delimiter_exclusions.find(c) == std::wstring_view::npos;
+  }
+  case TokenizationStyle::by_delimiters:
+    return data.processed_delimiters.find(c) != std::wstring_view::npos;
+  case TokenizationStyle::by_word_boundaries:
+    // boundaries depend on context so characters can't be classified alone, only tokenizer() uses the table built from it
+    return !IsCharAlphaNumeric(c);
+  case TokenizationStyle::COUNT:
+    break;
+  }
+  throw std::runtime_error("Incorrect tokenization style");
+}
+
+bool Settings::matches_ignore_regexp(std::wstring_view word) const {
+  if (data.ignore_linear_regexp)
+    return data.ignore_linear_regexp->full_match(word);
+
+  const auto regexp_ptr = std::get_if<std::wregex> (&data.ignore_regexp);
+  if (!regexp_ptr)
+    return false;
+  std::wstring key(word);
+  if (auto it = data.ignore_regexp_results.find(key); it != data.ignore_regexp_results.end())
+    return it->second;
+  if (data.ignore_regexp_results.size() >= max_cached_ignore_regexp_result_count)
+    data.ignore_regexp_results.clear();
+  auto result = std::regex_match(word.begin (), word.end (), *regexp_ptr);
+  data.ignore_regexp_results.emplace(std::move(key), result);
+  return result;
 }
 
 const std::regex_error *Settings::get_regexp_error() const {
@@ -148,8 +195,12 @@ void Settings::on_settings_changed() {
 
 void Settings::update_cached_values() {
   data.processed_delimiters = L" \n\r\t\v" + parse_string(data.delimiters.c_str());
+  data.delimiter_table = DelimiterTable([this](wchar_t c) { return is_delimiter(c); });
+  data.ignore_linear_regexp.reset();
+  data.ignore_regexp_results.clear();
   try {
     data.ignore_regexp = std::wregex (data.ignore_regexp_str);
+    data.ignore_linear_regexp = LinearRegex::compile(data.ignore_regexp_str);
   }
   catch (const std::regex_error &error) {
     data.ignore_regexp = error;
@@ -16,9 +16,11 @@
 
 #include "lsignal.h"
 #include "common/enum_array.h"
+#include "common/LinearRegex.h"
 #include "common/string_utils.h"
 #include "common/TemporaryAcessor.h"
 #include "common/Utility.h"
+#include "common/WordBoundaryTokenizer.h"
 #include "spellers/SpellerId.h"
 
 #include <regex>
@@ -64,6 +66,8 @@ enum class TokenizationStyle {
   by_non_alphabetic,
   by_non_ansi,
   by_delimiters,
+  // Unicode default word boundaries (UAX #29), see WordBoundaryTokenizer
+  by_word_boundaries,
 
   // ReSharper disable once CppInconsistentNaming
   COUNT,
@@ -83,50 +87,24 @@ public:
   Settings(std::wstring_view ini_filepath = L"");
   Settings(const Settings &) = delete;
   Settings &operator=(const Settings &) = delete;
-  const std::wregex *get_ignore_regexp() const;
+  // Uses LinearRegex if the pattern is supported by it, otherwise std::wregex with results cached per word
+  bool matches_ignore_regexp(std::wstring_view word) const;
   const std::regex_error *get_regexp_error() const;
   Settings(Settings &&) = delete;
   Settings &operator=(Settings &&) = delete;
   void on_settings_changed();
   void update_cached_values();
   void process(IniWorker &worker);
-  auto delimiter_tokenizer(std::wstring_view target) const { return make_delimiter_tokenizer(target, data.processed_delimiters, data.split_camel_case); }
-
-  auto non_alphabetic_tokenizer(std::wstring_view target) const {
-    return Tokenizer(target, [this](wchar_t c) { return !IsCharAlphaNumeric(c) && data.delimiter_exclusions.find(c) == std::wstring_view::npos; },
-                     data.split_camel_case);
-  }
+  // Classifies character according to the active tokenization style directly, used to build the delimiter table
+  bool is_delimiter(wchar_t c) const;
+  // Tokenizer for delimiter based tokenization styles, delimiters are looked up in the table built by update_cached_values()
+  auto tokenizer(std::wstring_view target) const { return Tokenizer(target, std::cref(data.delimiter_table), data.split_camel_case); }
 
+  // Calls `function` with tokenizer for the active tokenization style
   template <typename FunctionType> auto do_with_tokenizer(std::wstring_view target, const FunctionType &function) const {
-    switch (data.tokenization_style) {
-    case TokenizationStyle::by_non_alphabetic:
-      return function(this->non_alphabetic_tokenizer(target));
-    case TokenizationStyle::by_non_ansi:
-      return function(this->non_ansi_tokenizer(target));
-    case TokenizationStyle::by_delimiters:
-      return function(this->delimiter_tokenizer(target));
-    case TokenizationStyle::COUNT:
-      break;
-    }
-    throw std::runtime_error("Incorrect tokenization style");
-  }
-
-  auto non_ansi_tokenizer(std::wstring_view target) const {
-    return Tokenizer(target,
-                     [this](wchar_t c) {
-                       static const auto ansi_str = []() {
-                         constexpr auto char_cnt = 256;
-                         std::string s;
-                         for (int i = 1; i < char_cnt; ++i)
-                           s.push_back(static_cast<char>(i));
-                         auto ws = to_wstring(s);
-                         std::erase_if(ws, [](wchar_t c) { return !IsCharAlphaNumeric(c); });
-                         std::sort(ws.begin(), ws.end());
-                         return ws;
-                       }();
-                       return !std::binary_search(ansi_str.begin(), ansi_str.end(), c) && data.delimiter_exclusions.find(c) == std::wstring_view::npos;
-                     },
-                     data.split_camel_case);
+    if (data.tokenization_style == TokenizationStyle::by_word_boundaries)
+      return function(WordBoundaryTokenizer(target, data.split_camel_case));
+    return function(tokenizer(target));
   }
 
   void save(SettingsModificationStyle modification_style);
@@ -204,7 +182,10 @@ public:
     // Derivatives:
   private:
     std::wstring processed_delimiters;
+    DelimiterTable delimiter_table;
     std::variant<std::wregex, std::regex_error> ignore_regexp;
+    std::optional<LinearRegex> ignore_linear_regexp;
+    mutable std::unordered_map<std::wstring, bool> ignore_regexp_results;
 
     friend class Settings;
   } data;
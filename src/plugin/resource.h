@@ -226,6 +226,9 @@
 #define IDS_DOWNLOAD_ERRORS_ENCOUNTERED 40112
 #define IDC_WARNING_NO_DICTIONARIES_TITLE 40113
 #define IDC_WARNING_NO_DICTIONARIES_TEXT 40114
+#define IDS_SPLIT_WORDS_BY_WORD_BOUNDARIES 40115
+#define IDS_MISSPELLING_REPORT          40116
+#define IDS_MISSPELLING_REPORT_HEADER   40117
 
 // Next default values for new objects
 // 
@@ -0,0 +1,129 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "CachingSpeller.h"
+
+#include "LanguageInfo.h"
+
+namespace {
+constexpr size_t max_cached_word_count = 65536;
+}
+
+CachingSpeller::CachingSpeller(SpellerInterface &speller) : m_speller(speller) {
+}
+
+std::vector<LanguageInfo> CachingSpeller::get_language_list() const { return m_speller.get_language_list(); }
+
+void CachingSpeller::set_language(const wchar_t *lang) {
+  flush();
+  m_speller.set_language(lang);
+}
+
+void CachingSpeller::set_multiple_languages(const std::vector<std::wstring> &list) {
+  flush();
+  m_speller.set_multiple_languages(list);
+}
+
+void CachingSpeller::set_mode(SpellerMode mode) {
+  flush();
+  SpellerInterface::set_mode(mode);
+  m_speller.set_mode(mode);
+}
+
+std::wstring CachingSpeller::make_key(const WordForSpeller &word) {
+  // verdict could differ for words followed by dot (like "etc."), it's marked by the first character since with some
+  // delimiter settings dot could be a part of the word itself
+  std::wstring key(1, word.data.ends_with_dot ? L'\1' : L'\0');
+  key += word.str;
+  return key;
+}
+
+void CachingSpeller::store(std::wstring key, bool verdict) const {
+  if (m_verdicts.size() >= max_cached_word_count)
+    m_verdicts.clear();
+  m_verdicts.emplace(std::move(key), verdict);
+}
+
+bool CachingSpeller::check_word(const WordForSpeller &word) const {
+  auto key = make_key(word);
+  if (auto it = m_verdicts.find(key); it != m_verdicts.end()) {
+    ++m_hit_count;
+    return it->second;
+  }
+  ++m_miss_count;
+  auto verdict = m_speller.check_word(word);
+  store(std::move(key), verdict);
+  return verdict;
+}
+
+std::vector<bool> CachingSpeller::check_words(const std::vector<WordForSpeller> &words) const { return check_words_impl(words, false); }
+
+std::vector<bool> CachingSpeller::check_words_in_parallel(const std::vector<WordForSpeller> &words) const { return check_words_impl(words, true); }
+
+std::vector<bool> CachingSpeller::check_words_impl(const std::vector<WordForSpeller> &words, bool in_parallel) const {
+  std::vector<bool> result(words.size());
+  std::vector<WordForSpeller> unknown_words;
+  // index in unknown_words for every word which wasn't cached
+  std::vector<std::pair<size_t, size_t>> unknown_indices;
+  std::unordered_map<std::wstring, size_t> unknown_keys;
+  for (size_t i = 0; i < words.size(); ++i) {
+    auto key = make_key(words[i]);
+    if (auto it = m_verdicts.find(key); it != m_verdicts.end()) {
+      ++m_hit_count;
+      result[i] = it->second;
+      continue;
+    }
+    auto [it, inserted] = unknown_keys.emplace(std::move(key), unknown_words.size());
+    if (inserted) {
+      ++m_miss_count;
+      unknown_words.push_back(words[i]);
+    } else
+      ++m_hit_count;
+    unknown_indices.emplace_back(i, it->second);
+  }
+
+  if (unknown_words.empty())
+    return result;
+
+  auto verdicts = in_parallel ? m_speller.check_words_in_parallel(unknown_words) : m_speller.check_words(unknown_words);
+  // empty result means that all words are correct
+  if (verdicts.empty())
+    verdicts.resize(unknown_words.size(), true);
+
+  for (auto [index, unknown_index] : unknown_indices)
+    result[index] = verdicts[unknown_index];
+  for (auto &[key, unknown_index] : unknown_keys)
+    store(key, verdicts[unknown_index]);
+  return result;
+}
+
+std::vector<std::wstring> CachingSpeller::get_suggestions(const wchar_t *word) const { return m_speller.get_suggestions(word); }
+
+void CachingSpeller::request_suggestions(const wchar_t *word) const { m_speller.request_suggestions(word); }
+
+void CachingSpeller::cancel_suggestions_request() const { m_speller.cancel_suggestions_request(); }
+
+void CachingSpeller::add_to_dictionary(const wchar_t *word) {
+  flush();
+  m_speller.add_to_dictionary(word);
+}
+
+void CachingSpeller::ignore_all(const wchar_t *word) {
+  flush();
+  m_speller.ignore_all(word);
+}
+
+bool CachingSpeller::is_working() const { return m_speller.is_working(); }
+
+void CachingSpeller::flush() const { m_verdicts.clear(); }
@@ -0,0 +1,55 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "SpellerInterface.h"
+
+#include <unordered_map>
+
+// Wraps another speller and remembers verdicts for already checked words
+// Cache is bounded and dropped on anything which could change verdicts (language, mode, dictionary changes)
+class CachingSpeller : public SpellerInterface {
+public:
+  explicit CachingSpeller(SpellerInterface &speller);
+  std::vector<LanguageInfo> get_language_list() const override;
+  void set_language(const wchar_t *lang) override;
+  void set_multiple_languages(const std::vector<std::wstring> &list) override;
+  void set_mode(SpellerMode mode) override;
+  bool check_word(const WordForSpeller &word) const override;
+  // Each distinct word is passed to the wrapped speller at most once per batch
+  std::vector<bool> check_words(const std::vector<WordForSpeller> &words) const override;
+  std::vector<bool> check_words_in_parallel(const std::vector<WordForSpeller> &words) const override;
+  std::vector<std::wstring> get_suggestions(const wchar_t *word) const override;
+  void request_suggestions(const wchar_t *word) const override;
+  void cancel_suggestions_request() const override;
+  void add_to_dictionary(const wchar_t *word) override;
+  void ignore_all(const wchar_t *word) override;
+  bool is_working() const override;
+
+  void flush() const;
+  size_t hit_count() const { return m_hit_count; }
+  size_t miss_count() const { return m_miss_count; }
+
+private:
+  static std::wstring make_key(const WordForSpeller &word);
+  std::vector<bool> check_words_impl(const std::vector<WordForSpeller> &words, bool in_parallel) const;
+  void store(std::wstring key, bool verdict) const;
+
+private:
+  SpellerInterface &m_speller;
+  mutable std::unordered_map<std::wstring, bool> m_verdicts;
+  mutable size_t m_hit_count = 0;
+  mutable size_t m_miss_count = 0;
+};
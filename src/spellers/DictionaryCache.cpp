@@ -0,0 +1,153 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "DictionaryCache.h"
+
+#include "common/Utility.h"
+#include "common/string_utils.h"
+#include "common/winapi.h"
+
+namespace {
+constexpr std::array<char, 8> cache_magic = {'D', 'S', 'P', 'C', 'A', 'C', 'H', 'E'};
+
+struct CacheHeader {
+  std::array<char, 8> magic;
+  DictionaryCache::SourceStamp stamp;
+  uint64_t image_size;
+};
+
+// image starts at an offset aligned for any data Hunspell stores in it
+constexpr size_t image_offset = 64;
+static_assert(sizeof(CacheHeader) <= image_offset);
+
+uint64_t to_uint64(DWORD high, DWORD low) { return (static_cast<uint64_t>(high) << 32) | low; }
+
+std::optional<std::pair<uint64_t, uint64_t>> get_size_and_write_time(const std::wstring &path) {
+  WIN32_FILE_ATTRIBUTE_DATA data;
+  if (!GetFileAttributesEx(path.c_str(), GetFileExInfoStandard, &data))
+    return std::nullopt;
+  return std::pair{to_uint64(data.nFileSizeHigh, data.nFileSizeLow), to_uint64(data.ftLastWriteTime.dwHighDateTime, data.ftLastWriteTime.dwLowDateTime)};
+}
+
+// paths differing only in case or kind of slashes lead to the same file,
+// case tables are used instead of towlower so the result doesn't depend on locale
+std::wstring normalize_path(std::wstring_view path) {
+  std::wstring result(path);
+  std::transform(result.begin(), result.end(), result.begin(), [](wchar_t c) { return c == L'/' ? L'\\' : make_lower(c); });
+  return result;
+}
+
+bool write_all(HANDLE file, const char *data, size_t size) {
+  while (size > 0) {
+    DWORD written = 0;
+    auto portion = static_cast<DWORD>(std::min<size_t>(size, 1 << 24));
+    if (!WriteFile(file, data, portion, &written, nullptr) || written == 0)
+      return false;
+    data += written;
+    size -= written;
+  }
+  return true;
+}
+} // namespace
+
+DictionaryCache::MappedImage::MappedImage(void *view, size_t size)
+  : m_view(view), m_size(size) {
+}
+
+DictionaryCache::MappedImage::~MappedImage() {
+  if (m_view.get() != nullptr)
+    UnmapViewOfFile(m_view.get());
+}
+
+char *DictionaryCache::MappedImage::data() const { return static_cast<char *>(m_view.get()) + image_offset; }
+
+DictionaryCache::DictionaryCache(std::wstring directory)
+  : m_directory(std::move(directory)) {
+}
+
+std::optional<DictionaryCache::SourceStamp> DictionaryCache::get_source_stamp(const std::wstring &aff_path, const std::wstring &dic_path) {
+  auto aff = get_size_and_write_time(aff_path);
+  auto dic = get_size_and_write_time(dic_path);
+  if (!aff || !dic)
+    return std::nullopt;
+  return SourceStamp{aff->first, aff->second, dic->first, dic->second};
+}
+
+uint64_t DictionaryCache::path_hash(std::wstring_view dic_path) {
+  // 64-bit FNV-1a over UTF-16LE bytes, unlike std::hash it's the same for every build of the plugin
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (auto c : normalize_path(dic_path)) {
+    for (auto byte : {static_cast<uint8_t>(c & 0xFF), static_cast<uint8_t>(c >> 8)}) {
+      hash ^= byte;
+      hash *= 0x100000001b3ULL;
+    }
+  }
+  return hash;
+}
+
+std::wstring DictionaryCache::cache_path(const std::wstring &dic_path) const {
+  // dictionaries with the same name may be present in both user and system directories
+  auto normalized = normalize_path(dic_path);
+  auto name = std::wstring(PathFindFileName(normalized.c_str()));
+  return m_directory + L"\\" + name + wstring_printf(L".%016llx.cache", static_cast<unsigned long long>(path_hash(dic_path)));
+}
+
+std::unique_ptr<DictionaryCache::MappedImage> DictionaryCache::open(const std::wstring &dic_path, const SourceStamp &stamp) const {
+  if (!is_enabled())
+    return nullptr;
+  auto file = CreateFile(cache_path(dic_path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return nullptr;
+  LARGE_INTEGER file_size;
+  HANDLE mapping = nullptr;
+  if (GetFileSizeEx(file, &file_size) && static_cast<uint64_t>(file_size.QuadPart) > image_offset)
+    mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr)
+    return nullptr;
+  // view keeps the mapping alive by itself
+  auto view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+  CloseHandle(mapping);
+  if (view == nullptr)
+    return nullptr;
+
+  auto image = std::make_unique<MappedImage>(view, static_cast<size_t>(file_size.QuadPart) - image_offset);
+  CacheHeader header;
+  memcpy(&header, view, sizeof(header));
+  if (header.magic != cache_magic || header.stamp != stamp || header.image_size != image->size())
+    return nullptr;
+  return image;
+}
+
+bool DictionaryCache::save(const std::wstring &dic_path, const SourceStamp &stamp, const std::vector<char> &image) const {
+  if (!is_enabled() || !check_for_directory_existence(m_directory))
+    return false;
+  auto path = cache_path(dic_path);
+  auto temp_path = path + wstring_printf(L".%lu.tmp", GetCurrentProcessId());
+  auto file = CreateFile(temp_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+  std::array<char, image_offset> header_block = {};
+  CacheHeader header{cache_magic, stamp, image.size()};
+  memcpy(header_block.data(), &header, sizeof(header));
+  bool written = write_all(file, header_block.data(), header_block.size()) && write_all(file, image.data(), image.size());
+  CloseHandle(file);
+  // fails if the previous version is mapped by another instance, it will be replaced next time then
+  if (!written || !MoveFileEx(temp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+    WinApi::delete_file(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
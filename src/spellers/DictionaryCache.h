@@ -0,0 +1,64 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include "common/move_only.h"
+
+// Hash tables of Hunspell dictionaries stored as position-independent images, so the plugin maps them into memory
+// instead of parsing .dic files on every start. Cache file is used only if sizes and modification times of both
+// .aff and .dic are exactly the same as at the moment it was made.
+class DictionaryCache {
+public:
+  struct SourceStamp {
+    uint64_t aff_size = 0;
+    uint64_t aff_write_time = 0;
+    uint64_t dic_size = 0;
+    uint64_t dic_write_time = 0;
+
+    bool operator==(const SourceStamp &) const = default;
+  };
+
+  // Copy-on-write view of a cache file, Hunspell uses the image as is and writes to it only when words are added,
+  // so the pages stay shared otherwise
+  class MappedImage {
+  public:
+    explicit MappedImage(void *view, size_t size);
+    ~MappedImage();
+    MappedImage(MappedImage &&) = default;
+    MappedImage &operator=(MappedImage &&) = delete;
+    char *data() const;
+    size_t size() const { return m_size.get(); }
+
+  private:
+    move_only<void *> m_view;
+    move_only<size_t> m_size;
+  };
+
+  DictionaryCache() = default;
+  // Caching is disabled if `directory` is empty
+  explicit DictionaryCache(std::wstring directory);
+  bool is_enabled() const { return !m_directory.empty(); }
+  static std::optional<SourceStamp> get_source_stamp(const std::wstring &aff_path, const std::wstring &dic_path);
+  // Returns nullptr if there's no cache made for the same `stamp`
+  std::unique_ptr<MappedImage> open(const std::wstring &dic_path, const SourceStamp &stamp) const;
+  // Writes temporary file and renames it, so readers never see a partially written cache
+  bool save(const std::wstring &dic_path, const SourceStamp &stamp, const std::vector<char> &image) const;
+  // Cache file name is stable across runs and builds, so it's based on this hash of the path ignoring case and kind of slashes
+  static uint64_t path_hash(std::wstring_view dic_path);
+  std::wstring cache_path(const std::wstring &dic_path) const;
+
+private:
+  std::wstring m_directory;
+};
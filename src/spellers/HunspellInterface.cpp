@@ -20,63 +20,36 @@
 
 #include "LanguageInfo.h"
 #include "common/Utility.h"
+#include "common/utf8.h"
 #include "common/winapi.h"
 #include "hunspell/hunspell.hxx"
 #include "plugin/Plugin.h"
 #include "plugin/Settings.h"
 
 #include <fcntl.h>
-#include <fstream>
+#include <thread>
 
 namespace {
-void append_word_to_user_dictionary(const wchar_t *dictionary_path, const char *word) {
-  if (!dictionary_path)
-    return;
-
-  auto fp = _wfopen(dictionary_path, L"a");
-  fprintf(fp, "%s\n", word);
-  fclose(fp);
-}
+// words are checked in parallel only if every thread gets at least this many words
+constexpr size_t min_words_per_thread = 4096;
+// every set of copies takes as much memory as active dictionaries
+constexpr size_t max_worker_dics_count = 3;
+} // namespace
 
-std::vector<char> read_file_data(const wchar_t *file_path) {
-  auto fp = _wfopen(file_path, L"rb");
-  if (!fp)
-    return {};
-  _fseeki64(fp, 0, SEEK_END);
-  auto size = static_cast<size_t>(_ftelli64(fp));
-  std::vector<char> res(size + 1);
-  _fseeki64(fp, 0, SEEK_SET);
-  if (fread(res.data(), 1, size, fp) != size) {
-    fclose(fp);
-    return {};
+// user dictionary lines are parsed the same way Hunspell parses dictionary files:
+// "\/" is a slash inside of the word, first other slash separates affix flags
+static void add_user_dictionary_line(Hunspell &hunspell, std::string line) {
+  auto pos = line.find('/', 1);
+  while (pos != std::string::npos && line[pos - 1] == '\\') {
+    line.erase(pos - 1, 1);
+    pos = line.find('/', pos);
   }
-  fclose(fp);
-  return res;
-}
-
-void update_word_count(const wchar_t *dictionary_path) {
-  if (!dictionary_path || !PathFileExists(dictionary_path))
+  if (pos == std::string::npos) {
+    hunspell.add(line);
     return;
-
-  auto data = read_file_data(dictionary_path);
-  if (data.empty())
-    return;
-  auto line_cnt = std::count(data.begin(), data.end(), '\n') + 1 /*because number of lines = number of separators + 1 */
-                  - 1 /* because e should ignore line with current count */ - 1 /* final line end*/;
-  char *end_ptr;
-  auto cur_cnt = strtol(data.data(), &end_ptr, 10);
-  if (line_cnt != cur_cnt) {
-    auto fp = _wfopen(dictionary_path, L"wb");
-    fprintf(fp, "%Id\r\n", line_cnt);
-    auto it = std::find(data.begin(), data.end(), '\n');
-    if (it != data.end()) {
-      auto cnt_len = (it - data.begin()) + 1;
-      fwrite(data.data() + cnt_len, 1, data.size() - cnt_len - 1, fp);
-    }
-    fclose(fp);
   }
+  hunspell.add_with_flags(line.substr(0, pos), line.substr(pos + 1));
 }
-} // namespace
 
 static std::vector<std::wstring> list_files(const wchar_t *path, const wchar_t *mask, const wchar_t *filter) {
   WIN32_FIND_DATA ffd;
@@ -120,7 +93,8 @@ static std::vector<std::wstring> list_files(const wchar_t *path, const wchar_t *
 
 template <typename OutputCharType, typename InputCharType>
 static std::basic_string<OutputCharType> convert_impl(const IconvWrapperT &conv, std::basic_string_view<InputCharType> input) {
-  static std::vector<char> buf;
+  // conversion could happen on several threads simultaneously while checking words in parallel
+  static thread_local std::vector<char> buf;
   if constexpr (std::is_same_v<OutputCharType, char>)
     buf.resize((input.length() + 1) * 6);
   else
@@ -139,9 +113,74 @@ static std::basic_string<OutputCharType> convert_impl(const IconvWrapperT &conv,
   return {reinterpret_cast<OutputCharType *>(buf.data())};
 }
 
-std::string DicInfo::to_dictionary_encoding(std::wstring_view input) const { return convert_impl<char>(converter, input); }
+std::unique_ptr<SingleByteEncoding> SingleByteEncoding::create(const char *encoding) {
+  IconvWrapperT conv{"UCS-2LE", encoding};
+  if (conv.get() == iconv_t(-1))
+    return nullptr;
+  auto result = std::make_unique<SingleByteEncoding>();
+  for (int byte = 1; byte < static_cast<int>(result->m_to_utf16.size()); ++byte) {
+    iconv(conv.get(), nullptr, nullptr, nullptr, nullptr);
+    const auto in = static_cast<char>(byte);
+    auto in_buf = &in;
+    size_t in_size = 1;
+    wchar_t out = 0;
+    auto out_buf = reinterpret_cast<char *>(&out);
+    size_t out_size = sizeof(out);
+    if (iconv(conv.get(), &in_buf, &in_size, &out_buf, &out_size) == static_cast<size_t>(-1)) {
+      if (errno == EILSEQ)
+        continue; // byte isn't used by the encoding
+      // incomplete sequence or more than one character for a single byte
+      return nullptr;
+    }
+    if (in_size != 0 || out_size != 0)
+      return nullptr;
+    result->m_to_utf16[byte] = out;
+    auto &back = result->m_from_utf16[static_cast<size_t>(out)];
+    if (back == 0)
+      back = static_cast<unsigned char>(byte);
+  }
+  return result;
+}
+
+std::string SingleByteEncoding::encode(std::wstring_view input) const {
+  std::string result(input.length(), '\0');
+  for (size_t i = 0; i < input.length(); ++i) {
+    const auto c = static_cast<size_t>(input[i]);
+    if (c >= m_from_utf16.size() || m_from_utf16[c] == 0)
+      return {};
+    result[i] = static_cast<char>(m_from_utf16[c]);
+  }
+  return result;
+}
 
-std::wstring DicInfo::from_dictionary_encoding(std::string_view input) const { return convert_impl<wchar_t>(back_converter, input); }
+std::wstring SingleByteEncoding::decode(std::string_view input) const {
+  std::wstring result(input.length(), L'\0');
+  for (size_t i = 0; i < input.length(); ++i) {
+    const auto c = m_to_utf16[static_cast<unsigned char>(input[i])];
+    if (c == 0)
+      return {};
+    result[i] = c;
+  }
+  return result;
+}
+
+std::string DicInfo::to_dictionary_encoding(std::wstring_view input) const {
+  if (is_utf8) {
+    std::string result;
+    if (!append_utf16_as_utf8(result, input))
+      return {};
+    return result;
+  }
+  if (single_byte_encoding)
+    return single_byte_encoding->encode(input);
+  return convert_impl<char>(converter, input);
+}
+
+std::wstring DicInfo::from_dictionary_encoding(std::string_view input) const {
+  if (single_byte_encoding)
+    return single_byte_encoding->decode(input);
+  return convert_impl<wchar_t>(back_converter, input);
+}
 
 HunspellInterface::HunspellInterface(HWND npp_window_arg, const Settings &settings)
   : m_use_one_dic(false), m_settings(settings) {
@@ -149,6 +188,9 @@ HunspellInterface::HunspellInterface(HWND npp_window_arg, const Settings &settin
   m_singular_speller = {};
   m_last_selected_speller = {};
   m_is_hunspell_working = false;
+  std::vector<wchar_t> config_dir(MAX_PATH);
+  if (m_npp_window != nullptr && SendMessage(m_npp_window, NPPM_GETPLUGINSCONFIGDIR, config_dir.size(), reinterpret_cast<LPARAM>(config_dir.data())))
+    m_dictionary_cache = DictionaryCache(config_dir.data() + L"\\DSpellCheck Cache"s);
 }
 
 void HunspellInterface::update_on_dic_removal(wchar_t *path, bool &need_single_lang_reset, bool &need_multi_lang_reset) {
@@ -164,6 +206,8 @@ void HunspellInterface::update_on_dic_removal(wchar_t *path, bool &need_single_l
         need_multi_lang_reset = true;
       }
     m_all_hunspells.erase(it);
+    erase_worker_copies(path);
+    cancel_suggestions_request();
   }
 }
 
@@ -201,6 +245,60 @@ std::vector<LanguageInfo> HunspellInterface::get_language_list() const {
   return list;
 }
 
+void HunspellDeleter::operator()(Hunspell *hunspell) const { delete hunspell; }
+
+DicInfo HunspellInterface::load_dic_info(const AvailableLangInfo &lang_info, std::shared_ptr<UserDictionary> local_dictionary,
+                                         const UserDictionary &unified_dictionary, const DictionaryCache &cache, bool is_thread_copy) {
+  auto aff_path = lang_info.full_path + L".aff";
+  auto dic_path = lang_info.full_path + L".dic";
+  auto aff_buf_ansi = to_string(aff_path.c_str());
+  auto dic_buf_ansi = to_string(dic_path.c_str());
+  DicInfo new_dic;
+  new_dic.lang_info = lang_info;
+  new_dic.local_dictionary = std::move(local_dictionary);
+  // stamp is taken before reading files, so cache made from them couldn't be newer than its stamp
+  auto stamp = cache.is_enabled() ? DictionaryCache::get_source_stamp(aff_path, dic_path) : std::nullopt;
+  if (auto hash_image = stamp ? cache.open(dic_path, *stamp) : nullptr) {
+    new_dic.hunspell.reset(new Hunspell(aff_buf_ansi.c_str(), hash_image->data(), hash_image->size()));
+    if (new_dic.hunspell->is_hash_image_loaded())
+      new_dic.hunspell.get_deleter().hash_image = std::move(hash_image);
+    else
+      new_dic.hunspell.reset();
+  }
+  if (!new_dic.hunspell) {
+    new_dic.hunspell.reset(new Hunspell(aff_buf_ansi.c_str(), dic_buf_ansi.c_str()));
+    // loading is already done in background so the cache is updated right away,
+    // copies for worker threads are loaded simultaneously with the main one which does it
+    std::vector<char> image;
+    if (stamp && !is_thread_copy && new_dic.hunspell->save_hash_image(image))
+      cache.save(dic_path, *stamp, image);
+  }
+  auto new_hunspell = new_dic.hunspell.get();
+  const char *dic_encoding = new_hunspell->get_dic_encoding();
+  if (stricmp(dic_encoding, "Microsoft-cp1251") == 0)
+    dic_encoding = "cp1251"; // Queer fix for encoding which isn't being guessed
+  // correctly by libiconv TODO: Find other possible
+  // such failures
+  new_dic.is_utf8 = stricmp(dic_encoding, "UTF-8") == 0;
+  if (!new_dic.is_utf8)
+    new_dic.single_byte_encoding = SingleByteEncoding::create(dic_encoding);
+  new_dic.converter = {dic_encoding, "UCS-2LE"};
+  new_dic.back_converter = {"UCS-2LE", dic_encoding};
+  // user dictionaries are read from disk once, other languages and thread copies get words from memory
+  for (auto &line : new_dic.local_dictionary->words())
+    add_user_dictionary_line(*new_hunspell, line);
+  for (auto &line : unified_dictionary.words()) {
+    if (new_dic.is_utf8) {
+      add_user_dictionary_line(*new_hunspell, line);
+      continue;
+    }
+    auto encoded_line = new_dic.to_dictionary_encoding(utf8_to_wstring(line.c_str()));
+    if (!encoded_line.empty())
+      add_user_dictionary_line(*new_hunspell, std::move(encoded_line));
+  }
+  return new_dic;
+}
+
 DicInfo *HunspellInterface::create_hunspell(const AvailableLangInfo &lang_info) {
   {
     auto it = m_all_hunspells.find(lang_info.full_path);
@@ -210,43 +308,15 @@ DicInfo *HunspellInterface::create_hunspell(const AvailableLangInfo &lang_info)
   }
 
   DicInfo new_empty_dic;
+  new_empty_dic.lang_info = lang_info;
 
   new_empty_dic.loading_task = TaskWrapper(m_npp_window);
   new_empty_dic.loading_task->do_deferred(
-      [lang_info, dic_dir = m_dic_dir, user_dict_path = m_user_dic_path](concurrency::cancellation_token) {
-        auto aff_path = lang_info.full_path + L".aff";
-        auto dic_path = lang_info.full_path + L".dic";
-        auto aff_buf_ansi = to_string(aff_path.c_str());
-        auto dic_buf_ansi = to_string(dic_path.c_str());
-        auto new_name = aff_path.substr(0, aff_path.length() - 4);
+      [lang_info, local_dictionary = get_user_dictionary(m_dic_dir + L"\\"s + lang_info.name + L".usr"),
+       unified_dictionary = get_user_dictionary(m_user_dic_path), cache = m_dictionary_cache](concurrency::cancellation_token) {
         // shared_ptr is used only as a workaround due to the fact that TaskWrapper uses std::function
         // TODO: use some unique_function implementation in TaskWrapper and remove shared_ptr usage here.
-        auto new_dic = std::make_shared<DicInfo>();
-        new_dic->local_dic_path = dic_dir + L"\\"s + lang_info.name + L".usr";
-        auto new_hunspell = std::make_unique<Hunspell>(aff_buf_ansi.c_str(), dic_buf_ansi.c_str());
-        const char *dic_encoding = new_hunspell->get_dic_encoding();
-        if (stricmp(dic_encoding, "Microsoft-cp1251") == 0)
-          dic_encoding = "cp1251"; // Queer fix for encoding which isn't being guessed
-        // correctly by libiconv TODO: Find other possible
-        // such failures
-        new_dic->converter = {dic_encoding, "UCS-2LE"};
-        new_dic->back_converter = {"UCS-2LE", dic_encoding};
-        if (PathFileExists(new_dic->local_dic_path.c_str())) {
-          update_word_count(new_dic->local_dic_path.c_str());
-          new_hunspell->add_dic(to_string(new_dic->local_dic_path).c_str());
-        }
-        if (PathFileExists(user_dict_path.c_str())) {
-          if ("UTF-8"sv != dic_encoding) {
-            auto encoded_path = create_encoded_dict_version(user_dict_path.c_str(), dic_encoding);
-            if (!encoded_path.empty()) {
-              new_hunspell->add_dic(to_string(encoded_path).c_str());
-              WinApi::delete_file(encoded_path.c_str());
-            }
-          } else
-            new_hunspell->add_dic(to_string(user_dict_path).c_str());
-        }
-        new_dic->hunspell = std::move(new_hunspell);
-        return new_dic;
+        return std::make_shared<DicInfo>(load_dic_info(lang_info, local_dictionary, *unified_dictionary, cache, false));
       },
       [path = lang_info.full_path, this](std::shared_ptr<DicInfo> dic_info) {
         m_all_hunspells[path] = std::move(*dic_info);
@@ -290,139 +360,261 @@ void HunspellInterface::set_multiple_languages(const std::vector<std::wstring> &
   }
 }
 
-bool HunspellInterface::speller_check_word(const DicInfo &dic, WordForSpeller word) {
+bool HunspellInterface::speller_check_word(const DicInfo &dic, const WordForSpeller &word) {
   if (!dic.is_loaded())
     return true;
-  if (word.data.ends_with_dot)
-    word.str += L".";
   auto word_to_check = dic.to_dictionary_encoding(word.str.c_str());
   if (word_to_check.empty())
     return false;
+  if (word.data.ends_with_dot)
+    word_to_check += '.';
   // No additional check for memorized is needed since all words are already in
   // dictionary
 
   return dic.hunspell->spell(word_to_check);
 }
 
-bool HunspellInterface::check_word(const WordForSpeller &word) const {
-  if (m_ignored.find(word.str) != m_ignored.end())
+bool HunspellInterface::speller_check_utf8_word(const DicInfo &dic, const std::string &utf8_word) {
+  if (!dic.is_loaded())
     return true;
+  if (utf8_word.empty())
+    return false;
+  return dic.hunspell->spell(utf8_word);
+}
 
-  bool res = false;
+std::vector<const DicInfo *> HunspellInterface::active_dics() const {
   switch (m_speller_mode) {
-  case SpellerMode::SingleLanguage: {
+  case SpellerMode::SingleLanguage:
     if (m_singular_speller != nullptr)
-      res = speller_check_word(*m_singular_speller, word);
-    else
-      res = true;
+      return {m_singular_speller};
+    break;
+  case SpellerMode::MultipleLanguages:
+    return {m_spellers.begin(), m_spellers.end()};
   }
-  break;
-  case SpellerMode::MultipleLanguages: {
-    if (m_spellers.empty())
-      return true;
-
-    for (auto &speller : m_spellers) {
-      res = res || speller_check_word(*speller, word);
-      if (res)
-        break;
+  return {};
+}
+
+bool HunspellInterface::check_word_with(const std::vector<const DicInfo *> &dics, const WordForSpeller &word) const {
+  if (m_ignored.find(word.str) != m_ignored.end())
+    return true;
+
+  if (dics.empty())
+    return true;
+
+  // words come from UTF-16 text, so for UTF-8 dictionaries they're encoded once and the same bytes are given to all of them
+  static thread_local std::string utf8_word;
+  bool utf8_word_ready = false;
+  return std::any_of(dics.begin(), dics.end(), [&](const DicInfo *dic) {
+    if (!dic->is_utf8)
+      return speller_check_word(*dic, word);
+    if (!utf8_word_ready) {
+      utf8_word.clear();
+      if (!append_utf16_as_utf8(utf8_word, word.str))
+        utf8_word.clear();
+      else if (word.data.ends_with_dot)
+        utf8_word += '.';
+      utf8_word_ready = true;
     }
+    return speller_check_utf8_word(*dic, utf8_word);
+  });
+}
+
+bool HunspellInterface::check_word(const WordForSpeller &word) const {
+  return check_word_with(active_dics(), word);
+}
+
+std::vector<const DicInfo *> HunspellInterface::worker_copies(WorkerDics &worker_dics, const std::vector<const DicInfo *> &dics) const {
+  if (worker_dics.is_outdated) {
+    worker_dics.dics.clear();
+    worker_dics.is_outdated = false;
   }
-  break;
+  std::erase_if(worker_dics.dics, [&](const auto &p) {
+    return std::none_of(dics.begin(), dics.end(), [&](const DicInfo *dic) { return dic->lang_info.full_path == p.first; });
+  });
+  std::vector<const DicInfo *> copies;
+  for (auto dic : dics) {
+    auto &path = dic->lang_info.full_path;
+    if (auto it = worker_dics.dics.find(path); it != worker_dics.dics.end()) {
+      if (it->second.is_loaded())
+        copies.push_back(&it->second);
+      continue;
+    }
+    // same as in create_hunspell, copy is a placeholder with loading task until it's loaded
+    DicInfo new_copy;
+    new_copy.lang_info = dic->lang_info;
+    new_copy.loading_task = TaskWrapper(m_npp_window);
+    new_copy.loading_task->do_deferred(
+        [lang_info = dic->lang_info, local_dictionary = dic->local_dictionary, unified_dictionary = get_user_dictionary(m_user_dic_path),
+         cache = m_dictionary_cache](concurrency::cancellation_token) {
+          return std::make_shared<DicInfo>(load_dic_info(lang_info, local_dictionary, *unified_dictionary, cache, true));
+        },
+        [path, &worker_dics, added_word_count = m_added_word_count, this](std::shared_ptr<DicInfo> dic_info) {
+          // copies may be in use by a suggestion request, they're loaded again later then
+          std::unique_lock<std::mutex> lock(worker_dics.mutex, std::try_to_lock);
+          if (!lock.owns_lock()) {
+            worker_dics.is_outdated = true;
+            return;
+          }
+          // words added meanwhile could be missed, placeholder is removed so the copy is loaded again on demand
+          if (added_word_count != m_added_word_count)
+            worker_dics.dics.erase(path);
+          else
+            worker_dics.dics[path] = std::move(*dic_info);
+        });
+    worker_dics.dics.emplace(path, std::move(new_copy));
+  }
+  if (copies.size() != dics.size())
+    return {};
+  return copies;
+}
+
+void HunspellInterface::erase_worker_copies(const std::wstring &path) {
+  for (auto &worker_dics : m_worker_dics) {
+    std::unique_lock<std::mutex> lock(worker_dics->mutex, std::try_to_lock);
+    if (lock.owns_lock())
+      worker_dics->dics.erase(path);
+    else
+      worker_dics->is_outdated = true;
   }
-  return res;
+}
+
+std::vector<bool> HunspellInterface::check_words_in_parallel(const std::vector<WordForSpeller> &words) const {
+  auto dics = active_dics();
+  auto thread_count = std::min<size_t>(std::thread::hardware_concurrency(), words.size() / min_words_per_thread);
+  if (thread_count < 2 || dics.empty() || !std::all_of(dics.begin(), dics.end(), [](const DicInfo *dic) { return dic->is_loaded(); }))
+    return check_words(words);
+
+  // Hunspell objects are not thread-safe so every worker thread uses its own copies of dictionaries,
+  // ones which are still loading or used by someone else are skipped
+  while (m_worker_dics.size() < std::min(thread_count - 1, max_worker_dics_count))
+    m_worker_dics.push_back(std::make_shared<WorkerDics>());
+  std::vector<std::unique_lock<std::mutex>> locks;
+  std::vector<std::vector<const DicInfo *>> shard_dics{dics};
+  for (auto &worker_dics : m_worker_dics) {
+    if (shard_dics.size() == thread_count)
+      break;
+    std::unique_lock<std::mutex> lock(worker_dics->mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+      continue;
+    auto copies = worker_copies(*worker_dics, dics);
+    if (copies.empty())
+      continue;
+    shard_dics.push_back(std::move(copies));
+    locks.push_back(std::move(lock));
+  }
+  thread_count = shard_dics.size();
+  if (thread_count < 2)
+    return check_words(words);
+
+  std::vector<bool> result(words.size());
+  auto check_shard = [&](size_t shard_index) {
+    auto shard_begin = words.size() * shard_index / thread_count;
+    auto shard_end = words.size() * (shard_index + 1) / thread_count;
+    std::vector<bool> shard_result(shard_end - shard_begin);
+    for (auto i = shard_begin; i < shard_end; ++i)
+      shard_result[i - shard_begin] = check_word_with(shard_dics[shard_index], words[i]);
+    return shard_result;
+  };
+  std::vector<concurrency::task<std::vector<bool>>> tasks;
+  for (size_t shard_index = 1; shard_index < thread_count; ++shard_index)
+    tasks.push_back(concurrency::create_task([&, shard_index] { return check_shard(shard_index); }));
+  // the first shard is checked by the calling thread using original dictionaries
+  auto first_shard_result = check_shard(0);
+  std::copy(first_shard_result.begin(), first_shard_result.end(), result.begin());
+  for (size_t shard_index = 1; shard_index < thread_count; ++shard_index) {
+    auto shard_result = tasks[shard_index - 1].get();
+    std::copy(shard_result.begin(), shard_result.end(), result.begin() + words.size() * shard_index / thread_count);
+  }
+  return result;
 }
 
 void HunspellInterface::message_box_word_cannot_be_added() {
   MessageBox(m_npp_window, rc_str(IDC_ERROR_BAD_ENCODING).c_str(), rc_str(IDS_WORD_CANT_BE_ADDED).c_str(), MB_OK | MB_ICONWARNING);
 }
 
+void HunspellInterface::message_box_user_dictionary_cannot_be_saved() {
+  MessageBox(m_npp_window, rc_str(IDS_USER_DICT_CANT_SAVE_BODY).c_str(), rc_str(IDS_USER_DICT_CANT_SAVE_TITLE).c_str(), MB_OK | MB_ICONWARNING);
+}
+
+std::shared_ptr<UserDictionary> HunspellInterface::get_user_dictionary(const std::wstring &path) const {
+  auto &dictionary = m_user_dictionaries[path];
+  if (!dictionary)
+    dictionary = std::make_shared<UserDictionary>(path);
+  return dictionary;
+}
+
 HunspellInterface::~HunspellInterface() {
   m_is_hunspell_working = false;
 
   if (!m_system_wrong_dic_path.empty() && !m_user_dic_path.empty() && !are_paths_equal(m_system_wrong_dic_path.c_str(), m_user_dic_path.c_str())) {
     WinApi::delete_file(m_system_wrong_dic_path.c_str());
   }
-
-  update_word_count(m_user_dic_path.c_str());
-  for (auto &p : m_all_hunspells) {
-    auto &hs = p.second;
-    update_word_count(hs.local_dic_path.c_str());
-  }
 }
 
 void HunspellInterface::reset_spellers() {
-  // these triggers reload of all hunspells and user dictionaries
+  // these triggers reload of all hunspells and user dictionaries, journals of the latter are merged on destruction
   m_all_hunspells.clear();
+  for (auto &worker_dics : m_worker_dics)
+    worker_dics->is_outdated = true;
+  cancel_suggestions_request();
+  m_user_dictionaries.clear();
 }
 
 // drop cache if dictionary was removed
-void HunspellInterface::dictionary_removed(const std::wstring &path) { m_all_hunspells.erase(path); }
-
-std::wstring HunspellInterface::create_encoded_dict_version(const wchar_t *dict_path, const char *target_encoding) {
-  std::ifstream is(dict_path);
-  std::string line;
-  auto tmp_filename = _wtmpnam(nullptr);
-  std::ofstream os(tmp_filename);
-  while (std::getline(is, line)) {
-    auto result = convert_impl<char>(IconvWrapperT{target_encoding, "UTF-8"}, std::string_view(line));
-    if (!result.empty())
-      os << result << '\n';
-  }
-  return tmp_filename;
+void HunspellInterface::dictionary_removed(const std::wstring &path) {
+  m_all_hunspells.erase(path);
+  erase_worker_copies(path);
+  cancel_suggestions_request();
 }
 
 void HunspellInterface::add_to_dictionary(const wchar_t *word) {
   if (m_last_selected_speller == nullptr || !m_last_selected_speller->is_loaded())
     return;
 
-  std::wstring dic_path;
-  if (m_use_one_dic)
-    dic_path = m_user_dic_path;
-  else
-    dic_path = m_last_selected_speller->local_dic_path;
-
-  auto check_open = [&](const wchar_t *flags) {
-    SetFileAttributes(dic_path.c_str(), FILE_ATTRIBUTE_NORMAL);
-    auto fp = _wfopen(dic_path.c_str(), flags);
-    if (!fp) {
-      MessageBox(m_npp_window, rc_str(IDS_USER_DICT_CANT_SAVE_BODY).c_str(), rc_str(IDS_USER_DICT_CANT_SAVE_TITLE).c_str(), MB_OK | MB_ICONWARNING);
-      return;
-    }
-    if (flags == L"w"sv) {
-      fprintf(fp, "0\n");
+  cancel_suggestions_request();
+  ++m_added_word_count;
+  // word is added to copies as well, ones which are in use are loaded again later
+  std::vector<WorkerDics *> free_worker_dics;
+  std::vector<std::unique_lock<std::mutex>> locks;
+  for (auto &worker_dics : m_worker_dics) {
+    std::unique_lock<std::mutex> lock(worker_dics->mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      worker_dics->is_outdated = true;
+      continue;
     }
-    fclose(fp);
-  };
-
-  if (!PathFileExists(dic_path.c_str())) {
-    auto last_slash_pos = dic_path.rfind(L'\\');
-    if (last_slash_pos == std::wstring::npos)
-      return;
-    auto dir = dic_path.substr(0, last_slash_pos);
-    check_for_directory_existence(dir);
-    check_open(L"w");
-  } else {
-    check_open(L"a");
+    free_worker_dics.push_back(worker_dics.get());
+    locks.push_back(std::move(lock));
   }
+  auto add_to_copies = [&](const std::wstring &path, const std::string &conv_word) {
+    for (auto worker_dics : free_worker_dics)
+      if (auto it = worker_dics->dics.find(path); it != worker_dics->dics.end() && it->second.is_loaded())
+        it->second.hunspell->add(conv_word);
+  };
 
   if (m_use_one_dic) {
-    append_word_to_user_dictionary(m_user_dic_path.c_str(), to_utf8_string(word).c_str());
+    if (!get_user_dictionary(m_user_dic_path)->add(to_utf8_string(word)))
+      message_box_user_dictionary_cannot_be_saved();
+    // Adding word to all currently loaded dictionaries
     for (auto &p : m_all_hunspells) {
+      if (!p.second.is_loaded())
+        continue;
       auto conv_word = p.second.to_dictionary_encoding(word);
-      if (!conv_word.empty())
+      if (!conv_word.empty()) {
         p.second.hunspell->add(conv_word);
-      else if (p.second.hunspell == m_last_selected_speller->hunspell)
+        add_to_copies(p.first, conv_word);
+      } else if (p.second.hunspell == m_last_selected_speller->hunspell)
         message_box_word_cannot_be_added();
-      // Adding word to all currently loaded dictionaries and in memorized list
-      // to save it.
     }
   } else {
     auto conv_word = m_last_selected_speller->to_dictionary_encoding(word);
-    append_word_to_user_dictionary(m_last_selected_speller->local_dic_path.c_str(), conv_word.c_str());
-    if (!conv_word.empty())
-      m_last_selected_speller->hunspell->add(conv_word);
-    else
+    if (conv_word.empty()) {
       message_box_word_cannot_be_added();
+      return;
+    }
+    if (!m_last_selected_speller->local_dictionary->add(conv_word))
+      message_box_user_dictionary_cannot_be_saved();
+    m_last_selected_speller->hunspell->add(conv_word);
+    add_to_copies(m_last_selected_speller->lang_info.full_path, conv_word);
   }
 }
 
@@ -434,26 +626,28 @@ std::vector<std::wstring> HunspellInterface::get_suggestions(const wchar_t *word
   std::vector<std::string> list;
   m_last_selected_speller = nullptr;
 
-  switch (m_speller_mode) {
-  case SpellerMode::SingleLanguage: {
-    m_last_selected_speller = m_singular_speller;
-    if (!m_singular_speller->is_loaded())
-      return {};
-    list = m_singular_speller->hunspell->suggest(m_singular_speller->to_dictionary_encoding(word));
-  }
-  break;
-  case SpellerMode::MultipleLanguages: {
-    for (auto speller : m_spellers) {
-      if (!speller->is_loaded())
-        continue;
-      auto cur_list = speller->hunspell->suggest(speller->to_dictionary_encoding(word));
-      if (cur_list.size() > list.size()) {
-        list = std::move(cur_list);
-        m_last_selected_speller = speller;
+  if (!take_requested_suggestions(word, list)) {
+    switch (m_speller_mode) {
+    case SpellerMode::SingleLanguage: {
+      m_last_selected_speller = m_singular_speller;
+      if (!m_singular_speller->is_loaded())
+        return {};
+      list = m_singular_speller->hunspell->suggest(m_singular_speller->to_dictionary_encoding(word));
+    }
+    break;
+    case SpellerMode::MultipleLanguages: {
+      for (auto speller : m_spellers) {
+        if (!speller->is_loaded())
+          continue;
+        auto cur_list = speller->hunspell->suggest(speller->to_dictionary_encoding(word));
+        if (cur_list.size() > list.size()) {
+          list = std::move(cur_list);
+          m_last_selected_speller = speller;
+        }
       }
     }
-  }
-  break;
+    break;
+    }
   }
 
   if (!m_last_selected_speller)
@@ -464,6 +658,70 @@ std::vector<std::wstring> HunspellInterface::get_suggestions(const wchar_t *word
   return sugg_list;
 }
 
+void HunspellInterface::request_suggestions(const wchar_t *word) const {
+  auto dics = active_dics();
+  if (m_suggestion_request.is_made_for(word, dics))
+    return;
+  cancel_suggestions_request();
+  if (dics.empty() || !std::all_of(dics.begin(), dics.end(), [](const DicInfo *dic) { return dic->is_loaded(); }))
+    return;
+
+  // the same copies as for parallel checking are used, the first set which is free and loaded
+  if (m_worker_dics.empty())
+    m_worker_dics.push_back(std::make_shared<WorkerDics>());
+  std::shared_ptr<WorkerDics> free_worker_dics;
+  for (auto &worker_dics : m_worker_dics) {
+    std::unique_lock<std::mutex> lock(worker_dics->mutex, std::try_to_lock);
+    if (lock.owns_lock() && !worker_copies(*worker_dics, dics).empty()) {
+      free_worker_dics = worker_dics;
+      break;
+    }
+  }
+  if (!free_worker_dics)
+    return;
+
+  std::vector<std::wstring> paths;
+  for (auto dic : dics)
+    paths.push_back(dic->lang_info.full_path);
+  // same choice as in get_suggestions: the only dictionary in single language mode, the one giving the most suggestions otherwise
+  m_suggestion_request.start(
+      word, std::move(dics),
+      [word = std::wstring(word), paths = std::move(paths), worker_dics = std::move(free_worker_dics),
+       single_language = m_speller_mode == SpellerMode::SingleLanguage](concurrency::cancellation_token token) -> std::optional<RequestedSuggestions> {
+        RequestedSuggestions result;
+        std::lock_guard<std::mutex> lg(worker_dics->mutex);
+        // Hunspell couldn't be interrupted, so cancellation only skips remaining dictionaries
+        for (size_t i = 0; i < paths.size(); ++i) {
+          if (token.is_canceled())
+            return std::nullopt;
+          // copies could be changed on GUI thread before the mutex was taken
+          auto it = worker_dics->dics.find(paths[i]);
+          if (it == worker_dics->dics.end() || !it->second.is_loaded())
+            return std::nullopt;
+          auto list = it->second.hunspell->suggest(it->second.to_dictionary_encoding(word));
+          if (single_language || list.size() > result.list.size()) {
+            result.list = std::move(list);
+            result.dic_index = i;
+          }
+        }
+        return result;
+      });
+}
+
+void HunspellInterface::cancel_suggestions_request() const { m_suggestion_request.cancel(); }
+
+bool HunspellInterface::take_requested_suggestions(const wchar_t *word, std::vector<std::string> &list) const {
+  // suggestions which are still being computed aren't waited for, they're computed again synchronously
+  auto result = m_suggestion_request.take(word, active_dics());
+  if (!result)
+    return false;
+  if (!result->dic_index)
+    return true;
+  list = std::move(result->list);
+  m_last_selected_speller = m_speller_mode == SpellerMode::SingleLanguage ? m_singular_speller : m_spellers[*result->dic_index];
+  return true;
+}
+
 void HunspellInterface::set_directory(const wchar_t *dir) {
   if (dir == nullptr || *dir == L'\0')
     return;
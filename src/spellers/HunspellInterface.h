@@ -16,7 +16,10 @@
 
 #include "iconv.h"
 #include "lsignal.h"
+#include "DictionaryCache.h"
 #include "SpellerInterface.h"
+#include "SuggestionRequest.h"
+#include "UserDictionary.h"
 #include "common/Utility.h"
 #include "common/TaskWrapper.h"
 
@@ -49,25 +52,63 @@ private:
   std::unique_ptr<void, void (*)(iconv_t)> m_conv;
 };
 
+// Lookup tables replacing iconv for dictionaries in single byte encodings (cp1251, ISO-8859-x, KOI8-R and so on)
+class SingleByteEncoding {
+public:
+  // Returns nullptr if `encoding` isn't a single byte one, so iconv should be used for it
+  static std::unique_ptr<SingleByteEncoding> create(const char *encoding);
+  // Both return empty string if some character couldn't be converted, same as iconv based conversion
+  std::string encode(std::wstring_view input) const;
+  std::wstring decode(std::string_view input) const;
+
+private:
+  std::array<wchar_t, 0x100> m_to_utf16 = {};            // 0 for bytes not used by the encoding
+  std::array<unsigned char, 0x10000> m_from_utf16 = {}; // 0 for characters absent in the encoding
+};
+
+class AvailableLangInfo {
+public:
+  std::wstring name;
+  int type = 0; // Type = 1 - System Dir Dictionary, 0 - Nomal Dictionary
+  std::wstring full_path;
+
+  bool operator<(const AvailableLangInfo &rhs) const { return name < rhs.name; }
+};
+
+// Deletes Hunspell before unmapping the cache file its hash table was loaded from
+class HunspellDeleter {
+public:
+  void operator()(Hunspell *hunspell) const;
+  std::unique_ptr<DictionaryCache::MappedImage> hash_image;
+};
+
 class DicInfo {
 public:
-  std::unique_ptr<Hunspell> hunspell;
+  std::unique_ptr<Hunspell, HunspellDeleter> hunspell;
   IconvWrapperT converter;
   IconvWrapperT back_converter;
-  std::wstring local_dic_path;
+  // words added specifically to this language, in dictionary encoding
+  std::shared_ptr<UserDictionary> local_dictionary;
+  AvailableLangInfo lang_info;
+  // words for UTF-8 dictionaries are encoded directly, without iconv
+  bool is_utf8 = false;
+  // set for single byte encodings, iconv converters are used only for multibyte ones otherwise
+  std::unique_ptr<SingleByteEncoding> single_byte_encoding;
   std::string to_dictionary_encoding(std::wstring_view input) const;
   std::wstring from_dictionary_encoding(std::string_view input) const;
   std::optional<TaskWrapper> loading_task;
   bool is_loaded() const { return !loading_task; }
 };
 
-class AvailableLangInfo {
+// Copies of dictionaries for worker threads, since Hunspell objects are not thread-safe.
+// They're loaded in background and updated together with the originals, used both for checking and suggestions.
+// `dics` is changed only on GUI thread holding the mutex, whoever uses copies holds it too
+class WorkerDics {
 public:
-  std::wstring name;
-  int type = 0; // Type = 1 - System Dir Dictionary, 0 - Nomal Dictionary
-  std::wstring full_path;
-
-  bool operator<(const AvailableLangInfo &rhs) const { return name < rhs.name; }
+  std::mutex mutex;
+  std::map<std::wstring, DicInfo> dics; // full path -> copy
+  // set if dictionaries changed while copies were in use, they're loaded again then
+  bool is_outdated = false;
 };
 
 class HunspellInterface : public SpellerInterface {
@@ -78,8 +119,15 @@ public:
   void set_language(const wchar_t *lang) override;
   void set_multiple_languages(const std::vector<std::wstring> &list) override; // Languages are from SelectMultipleLanguagesDialog
   bool check_word(const WordForSpeller &word) const override;                  // Word in Utf-8 or ANSI
+  // Splits words into consecutive shards checked simultaneously, each worker thread uses its own copies of dictionaries.
+  // Only copies which are already loaded are used, words are checked by the calling thread alone until then
+  std::vector<bool> check_words_in_parallel(const std::vector<WordForSpeller> &words) const override;
   bool is_working() const override;
   std::vector<std::wstring> get_suggestions(const wchar_t *word) const override;
+  // Worker thread uses a set of copies of active dictionaries, so checking continues meanwhile.
+  // Nothing is requested until some set is free and loaded, suggestions are computed on demand then
+  void request_suggestions(const wchar_t *word) const override;
+  void cancel_suggestions_request() const override;
   void add_to_dictionary(const wchar_t *word) override;
   void ignore_all(const wchar_t *word) override;
 
@@ -92,10 +140,23 @@ public:
   void dictionary_removed(const std::wstring &path);
 
 private:
-  static std::wstring create_encoded_dict_version(const wchar_t *dict_path, const char *target_encoding);
+  static DicInfo load_dic_info(const AvailableLangInfo &lang_info, std::shared_ptr<UserDictionary> local_dictionary,
+                               const UserDictionary &unified_dictionary, const DictionaryCache &cache, bool is_thread_copy);
+  std::shared_ptr<UserDictionary> get_user_dictionary(const std::wstring &path) const;
   DicInfo *create_hunspell(const AvailableLangInfo &lang_info);
-  static bool speller_check_word(const DicInfo &dic, WordForSpeller word);
+  static bool speller_check_word(const DicInfo &dic, const WordForSpeller &word);
+  // `utf8_word` is the word already converted for UTF-8 dictionaries, empty if conversion failed
+  static bool speller_check_utf8_word(const DicInfo &dic, const std::string &utf8_word);
+  std::vector<const DicInfo *> active_dics() const;
+  bool check_word_with(const std::vector<const DicInfo *> &dics, const WordForSpeller &word) const;
+  // Returns copies of `dics` from `worker_dics` or nothing if some of them are not loaded yet, their loading is started then.
+  // Copies of other dictionaries are dropped, so caller should hold the mutex
+  std::vector<const DicInfo *> worker_copies(WorkerDics &worker_dics, const std::vector<const DicInfo *> &dics) const;
+  void erase_worker_copies(const std::wstring &path);
+  // Returns false if there's no finished request for `word` made with the same active dictionaries
+  bool take_requested_suggestions(const wchar_t *word, std::vector<std::string> &list) const;
   void message_box_word_cannot_be_added();
+  void message_box_user_dictionary_cannot_be_saved();
 
 private:
   bool m_is_hunspell_working = false;
@@ -107,11 +168,20 @@ private:
   DicInfo *m_singular_speller = nullptr;
   mutable DicInfo *m_last_selected_speller = nullptr;
   std::vector<DicInfo *> m_spellers;
+  // Sets of dictionary copies for worker threads, each takes as much memory as originals so their number is limited.
+  // Sets are never removed since a worker thread may still use them
+  mutable std::vector<std::shared_ptr<WorkerDics>> m_worker_dics;
+  // Incremented whenever a word is added, copies which started loading before that are loaded again
+  size_t m_added_word_count = 0;
+  mutable SuggestionRequest m_suggestion_request;
   std::unordered_set<std::wstring> m_ignored;
   std::wstring m_user_dic_path;         // For now only default one.
   std::wstring m_system_wrong_dic_path; // Only for reading and then removing
+  // All user dictionaries (path -> dictionary) are loaded once and shared by dictionaries of every language
+  mutable std::map<std::wstring, std::shared_ptr<UserDictionary>> m_user_dictionaries;
   HWND m_npp_window = nullptr;
   const Settings &m_settings;
+  DictionaryCache m_dictionary_cache;
 
 public:
   mutable lsignal::signal<void()> speller_loaded;
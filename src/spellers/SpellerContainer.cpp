@@ -15,6 +15,7 @@
 #include "SpellerContainer.h"
 
 #include "AspellInterface.h"
+#include "CachingSpeller.h"
 #include "HunspellInterface.h"
 #include "LanguageInfo.h"
 #include "NativeSpellerInterface.h"
@@ -32,7 +33,7 @@ void SpellerContainer::create_spellers(const NppData &npp_data) {
 
 void SpellerContainer::fill_speller_ptr_array() {
   for (auto id : enum_range<SpellerId>()) {
-    m_spellers[id] = [&]() -> SpellerInterface* {
+    auto speller = [&]() -> SpellerInterface* {
       switch (id) {
       case SpellerId::aspell:
         return m_aspell_speller.get();
@@ -45,6 +46,7 @@ void SpellerContainer::fill_speller_ptr_array() {
       }
       return nullptr;
     }();
+    m_spellers[id] = std::make_unique<CachingSpeller>(*speller);
   }
 }
 
@@ -68,10 +70,72 @@ const SpellerInterface &SpellerContainer::active_speller() const { return const_
 void SpellerContainer::cleanup() { m_native_speller->cleanup(); }
 
 SpellerInterface &SpellerContainer::active_speller() {
-  if (!m_single_speller)
+  if (!m_single_caching_speller)
     return *m_spellers[m_settings.data.active_speller_lib_id];
 
-  return *m_single_speller;
+  return *m_single_caching_speller;
+}
+
+size_t SpellerContainer::word_cache_hit_count() const {
+  return static_cast<const CachingSpeller &>(active_speller()).hit_count();
+}
+
+size_t SpellerContainer::word_cache_miss_count() const {
+  return static_cast<const CachingSpeller &>(active_speller()).miss_count();
+}
+
+void SpellerContainer::flush_word_caches() const {
+  for (auto &speller : m_spellers)
+    if (speller)
+      speller->flush();
+  if (m_single_caching_speller)
+    m_single_caching_speller->flush();
+}
+
+std::wstring SpellerContainer::suggestion_cache_key(const std::wstring &word) const {
+  const auto &language = m_settings.get_active_language();
+  const auto &languages = language != multiple_language_alias ? language : m_settings.get_active_multi_languages();
+  // neither language names nor words contain line breaks
+  return std::to_wstring(static_cast<int>(m_settings.data.active_speller_lib_id)) + L'\n' + languages + L'\n' + word;
+}
+
+std::vector<std::wstring> SpellerContainer::get_suggestions(const std::wstring &word) const {
+  auto key = suggestion_cache_key(word);
+  if (auto it = m_suggestion_cache_index.find(key); it != m_suggestion_cache_index.end()) {
+    ++m_suggestion_cache_hit_count;
+    m_suggestion_cache.splice(m_suggestion_cache.begin(), m_suggestion_cache, it->second);
+    return it->second->second;
+  }
+  ++m_suggestion_cache_miss_count;
+  auto suggestions = active_speller().get_suggestions(word.c_str());
+  m_last_computed_suggestions_word = word;
+  if (m_suggestion_cache.size() >= max_cached_suggestion_count) {
+    m_suggestion_cache_index.erase(m_suggestion_cache.back().first);
+    m_suggestion_cache.pop_back();
+  }
+  m_suggestion_cache.emplace_front(key, suggestions);
+  m_suggestion_cache_index.emplace(std::move(key), m_suggestion_cache.begin());
+  return suggestions;
+}
+
+void SpellerContainer::request_suggestions(const std::wstring &word) const {
+  if (m_suggestion_cache_index.contains(suggestion_cache_key(word)))
+    return;
+  active_speller().request_suggestions(word.c_str());
+}
+
+void SpellerContainer::compute_suggestions_by_speller(const std::wstring &word) {
+  // calling get_suggestions before ignoring or adding the word is a requirement by some spellers currently
+  // we're just discarding the result, unless the speller has just computed it itself
+  if (word != m_last_computed_suggestions_word)
+    static_cast<void>(active_speller().get_suggestions(word.c_str()));
+  m_last_computed_suggestions_word = word;
+}
+
+void SpellerContainer::flush_suggestion_cache() const {
+  m_suggestion_cache.clear();
+  m_suggestion_cache_index.clear();
+  m_last_computed_suggestions_word.clear();
 }
 
 void SpellerContainer::init_spellers(const NppData &npp_data) {
@@ -86,26 +150,38 @@ void SpellerContainer::on_settings_changed() {
 
 void SpellerContainer::ignore_word(std::wstring wstr) {
   SpellCheckerHelpers::apply_word_conversions(m_settings, wstr);
-  // calling get_suggestions before ignoring the word is a requirement by some spellers currently
-  // we're just discarding the result
-  static_cast<void>(active_speller().get_suggestions(wstr.c_str()));
+  compute_suggestions_by_speller(wstr);
   active_speller().ignore_all(wstr.c_str());
+  m_last_computed_suggestions_word.clear();
 }
 
 void SpellerContainer::add_to_dictionary(std::wstring wstr) {
   SpellCheckerHelpers::apply_word_conversions(m_settings, wstr);
+  compute_suggestions_by_speller(wstr);
   active_speller().add_to_dictionary(wstr.c_str());
+  // added word could be suggested for other words now
+  flush_suggestion_cache();
 }
 
 SpellerContainer::SpellerContainer(const Settings *settings, const NppData *npp_data)
   : m_settings(*settings) {
   init_spellers(*npp_data);
+  // dictionaries could be reloaded or removed without going through the caching layer
+  speller_status_changed.connect([this] {
+    flush_word_caches();
+    flush_suggestion_cache();
+  });
   m_settings.settings_changed.connect([this] { on_settings_changed(); });
 }
 
 SpellerContainer::SpellerContainer(const Settings *settings, std::unique_ptr<SpellerInterface> speller)
-  : m_settings(*settings), m_spellers({}) {
+  : m_settings(*settings) {
   m_single_speller = std::move(speller);
+  m_single_caching_speller = std::make_unique<CachingSpeller>(*m_single_speller);
+  speller_status_changed.connect([this] {
+    flush_word_caches();
+    flush_suggestion_cache();
+  });
   m_settings.settings_changed.connect([this] { on_settings_changed(); });
   on_settings_changed();
 }
@@ -18,9 +18,13 @@
 #include "common/enum_array.h"
 #include "common/TemporaryAcessor.h"
 
+#include <list>
+#include <unordered_map>
+
 class NppData;
 class Settings;
 class AspellInterface;
+class CachingSpeller;
 class HunspellInterface;
 class NativeSpellerInterface;
 class SpellerInterface;
@@ -58,6 +62,17 @@ public:
   void cleanup();
   void ignore_word(std::wstring wstr);
   void add_to_dictionary(std::wstring wstr);
+  // Verdict cache hit/miss counters of the active speller
+  size_t word_cache_hit_count() const;
+  size_t word_cache_miss_count() const;
+  // Suggestions of the active speller, ones for recently asked words are reused until spellers change
+  std::vector<std::wstring> get_suggestions(const std::wstring &word) const;
+  // Does nothing if suggestions for `word` are already cached
+  void request_suggestions(const std::wstring &word) const;
+  size_t suggestion_cache_hit_count() const { return m_suggestion_cache_hit_count; }
+  size_t suggestion_cache_miss_count() const { return m_suggestion_cache_miss_count; }
+
+  static constexpr size_t max_cached_suggestion_count = 32;
 
 public:
   mutable lsignal::signal<void()> speller_status_changed;
@@ -68,12 +83,27 @@ private:
   void fill_speller_ptr_array();
   void init_spellers(const NppData &npp_data);
   void on_settings_changed();
+  void flush_word_caches() const;
+  std::wstring suggestion_cache_key(const std::wstring &word) const;
+  void flush_suggestion_cache() const;
+  void compute_suggestions_by_speller(const std::wstring &word);
 
 private:
   const Settings &m_settings;
   std::unique_ptr<AspellInterface> m_aspell_speller;
   std::unique_ptr<HunspellInterface> m_hunspell_speller;
   std::unique_ptr<NativeSpellerInterface> m_native_speller;
-  enum_array<SpellerId, SpellerInterface *> m_spellers;
+  // All spellers are accessed through verdict caches
+  enum_array<SpellerId, std::unique_ptr<CachingSpeller>> m_spellers;
   std::unique_ptr<SpellerInterface> m_single_speller;
+  std::unique_ptr<CachingSpeller> m_single_caching_speller;
+  // (speller id, languages, word) -> suggestions, most recently used first
+  using SuggestionCache = std::list<std::pair<std::wstring, std::vector<std::wstring>>>;
+  mutable SuggestionCache m_suggestion_cache;
+  mutable std::unordered_map<std::wstring, SuggestionCache::iterator> m_suggestion_cache_index;
+  // Word for which the active speller computed suggestions itself last time, spellers remember which dictionary gave them
+  // and ignore/add words there, so cached suggestions aren't enough before that
+  mutable std::wstring m_last_computed_suggestions_word;
+  mutable size_t m_suggestion_cache_hit_count = 0;
+  mutable size_t m_suggestion_cache_miss_count = 0;
 };
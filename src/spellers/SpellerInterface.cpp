@@ -29,6 +29,11 @@ SpellerInterface::check_words(const std::vector<WordForSpeller> &words) const {
   return ret;
 }
 
+std::vector<bool>
+SpellerInterface::check_words_in_parallel(const std::vector<WordForSpeller> &words) const {
+  return check_words(words);
+}
+
 std::vector<LanguageInfo> DummySpeller::get_language_list() const { return {}; }
 
 void DummySpeller::set_language(const wchar_t * /*lang*/) {}
@@ -43,15 +43,22 @@ public:
   virtual void set_language(const wchar_t *lang) = 0;
   virtual void set_multiple_languages(
       const std::vector<std::wstring> &list) = 0; // Languages are from SelectMultipleLanguagesDialog
-  void set_mode(SpellerMode multi) { m_speller_mode = multi; }
+  virtual void set_mode(SpellerMode multi) { m_speller_mode = multi; }
   // Implement either check_word or check_words or get the endless recursion
   virtual bool check_word(const WordForSpeller &word) const;
   // Functions which should be implemented in case if words for some awkward
   // reason could be faster checked in bulk
   virtual std::vector<bool>
   check_words(const std::vector<WordForSpeller> &words) const;
+  // Used for big batches of words, spellers which could check words on several threads should override it
+  virtual std::vector<bool>
+  check_words_in_parallel(const std::vector<WordForSpeller> &words) const;
   virtual std::vector<std::wstring>
   get_suggestions(const wchar_t *word) const = 0;
+  // Starts computing suggestions for `word` on a worker thread, so get_suggestions for the same word doesn't have to wait for them,
+  // the previous request is cancelled. Spellers which couldn't do it ignore requests and compute suggestions in get_suggestions
+  virtual void request_suggestions(const wchar_t * /*word*/) const {}
+  virtual void cancel_suggestions_request() const {}
   virtual void add_to_dictionary(const wchar_t *word) = 0;
   virtual void ignore_all(const wchar_t *word) = 0;
   virtual bool is_working() const = 0;
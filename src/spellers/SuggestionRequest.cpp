@@ -0,0 +1,54 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "SuggestionRequest.h"
+
+SuggestionRequest::~SuggestionRequest() {
+  cancel();
+  wait();
+}
+
+bool SuggestionRequest::is_made_for(const std::wstring &word, const Dics &dics) const {
+  return m_cancellation && m_word == word && m_dics == dics;
+}
+
+void SuggestionRequest::start(std::wstring word, Dics dics, Computation computation) {
+  cancel();
+  m_word = std::move(word);
+  m_dics = std::move(dics);
+  std::erase_if(m_tasks, [](const auto &task) { return task.is_done(); });
+  auto token = m_cancellation.emplace().get_token();
+  m_tasks.push_back(concurrency::create_task([computation = std::move(computation), token] { return computation(token); }, token));
+}
+
+void SuggestionRequest::cancel() {
+  if (!m_cancellation)
+    return;
+  m_cancellation->cancel();
+  m_cancellation.reset();
+}
+
+std::optional<RequestedSuggestions> SuggestionRequest::take(const std::wstring &word, const Dics &dics) {
+  // checked before cancelling, so a finished task is a completed one and get() doesn't throw
+  bool is_ready = is_made_for(word, dics) && m_tasks.back().is_done();
+  cancel();
+  if (!is_ready)
+    return std::nullopt;
+  return m_tasks.back().get();
+}
+
+void SuggestionRequest::wait() const {
+  for (auto &task : m_tasks)
+    task.wait();
+}
@@ -0,0 +1,58 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+#include <ppltasks.h>
+
+class DicInfo;
+
+// Suggestions in dictionary encoding from the dictionary which gave the most of them
+class RequestedSuggestions {
+public:
+  std::vector<std::string> list;
+  std::optional<size_t> dic_index; // index among dictionaries which were active at the moment of request
+};
+
+// Suggestions for a word computed on a worker thread before they're asked for.
+// Everything except the computation itself is done on GUI thread, which never waits for the worker:
+// result is taken only if it's ready and was requested for the same word and dictionaries
+class SuggestionRequest {
+public:
+  using Dics = std::vector<const DicInfo *>;
+  // Returns nothing if suggestions couldn't be computed, e.g. dictionaries were unavailable or request was cancelled
+  using Computation = std::function<std::optional<RequestedSuggestions>(concurrency::cancellation_token)>;
+
+  SuggestionRequest() = default;
+  SuggestionRequest(const SuggestionRequest &) = delete;
+  SuggestionRequest &operator=(const SuggestionRequest &) = delete;
+  // Cancels the request and waits for the worker, so it doesn't outlive objects it uses
+  ~SuggestionRequest();
+
+  bool is_made_for(const std::wstring &word, const Dics &dics) const;
+  // Previous request is cancelled
+  void start(std::wstring word, Dics dics, Computation computation);
+  void cancel();
+  // Request is finished in any case, result is returned only if it's ready and matches `word` and `dics`
+  std::optional<RequestedSuggestions> take(const std::wstring &word, const Dics &dics);
+  // Waits until all started computations finish, including cancelled ones
+  void wait() const;
+
+private:
+  std::wstring m_word;
+  Dics m_dics;
+  std::optional<concurrency::cancellation_token_source> m_cancellation;
+  // the last one belongs to the current request, others were cancelled but may still be running
+  std::vector<concurrency::task<std::optional<RequestedSuggestions>>> m_tasks;
+};
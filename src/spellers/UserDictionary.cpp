@@ -0,0 +1,181 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "UserDictionary.h"
+
+#include "common/Utility.h"
+#include "common/winapi.h"
+
+namespace {
+// journal is merged in background after this many words, so it stays short during long sessions
+constexpr size_t compaction_threshold = 100;
+
+std::vector<std::string> read_lines(const std::wstring &path) {
+  std::vector<std::string> lines;
+  auto fp = _wfopen(path.c_str(), L"rb");
+  if (!fp)
+    return lines;
+  std::string data;
+  std::array<char, 1 << 16> buf;
+  size_t read_size;
+  while ((read_size = fread(buf.data(), 1, buf.size(), fp)) > 0)
+    data.append(buf.data(), read_size);
+  fclose(fp);
+
+  size_t pos = data.starts_with("\xEF\xBB\xBF") ? 3 : 0;
+  while (pos < data.size()) {
+    auto end = data.find('\n', pos);
+    if (end == std::string::npos)
+      end = data.size();
+    auto line_end = end;
+    if (line_end > pos && data[line_end - 1] == '\r')
+      --line_end;
+    if (line_end > pos)
+      lines.emplace_back(data, pos, line_end - pos);
+    pos = end + 1;
+  }
+  return lines;
+}
+
+std::vector<std::string> read_dictionary_words(const std::wstring &path) {
+  auto lines = read_lines(path);
+  // first line is the word count, it's ignored since it's not always up to date in files edited by hand.
+  // Same as Hunspell, numeric first line is always the count
+  if (!lines.empty() && std::all_of(lines.front().begin(), lines.front().end(), [](char c) { return c >= '0' && c <= '9'; }))
+    lines.erase(lines.begin());
+  return lines;
+}
+} // namespace
+
+UserDictionary::UserDictionary(std::wstring path)
+  : m_path(std::move(path)) {
+}
+
+UserDictionary::~UserDictionary() {
+  if (m_compaction)
+    m_compaction->wait();
+  compact();
+  if (m_journal)
+    fclose(m_journal);
+}
+
+std::wstring UserDictionary::journal_path() const { return m_path + L".journal"; }
+
+void UserDictionary::load() const {
+  if (m_loaded)
+    return;
+  m_loaded = true;
+  for (auto &word : read_dictionary_words(m_path)) {
+    if (m_word_set.insert(word).second)
+      m_words.push_back(std::move(word));
+  }
+  // journal is left only if the plugin didn't finish properly or its merge failed
+  for (auto &word : read_lines(journal_path())) {
+    if (m_word_set.insert(word).second) {
+      m_words.push_back(word);
+      m_journal_words.push_back(std::move(word));
+    }
+  }
+}
+
+std::vector<std::string> UserDictionary::words() const {
+  std::lock_guard<std::mutex> lg(m_mutex);
+  load();
+  return m_words;
+}
+
+bool UserDictionary::add(const std::string &word) {
+  {
+    std::lock_guard<std::mutex> lg(m_mutex);
+    load();
+    if (!m_word_set.insert(word).second)
+      return true;
+    m_words.push_back(word);
+    if (!m_journal) {
+      auto last_slash_pos = m_path.rfind(L'\\');
+      if (last_slash_pos != std::wstring::npos)
+        check_for_directory_existence(m_path.substr(0, last_slash_pos));
+      m_journal = _wfopen(journal_path().c_str(), L"ab");
+      if (!m_journal)
+        return false;
+    }
+    if (fprintf(m_journal, "%s\r\n", word.c_str()) < 0 || fflush(m_journal) != 0)
+      return false;
+    m_journal_words.push_back(word);
+    if (m_journal_words.size() < compaction_threshold)
+      return true;
+  }
+  start_compaction();
+  return true;
+}
+
+void UserDictionary::start_compaction() {
+  if (m_compaction && !m_compaction->is_done())
+    return;
+  m_compaction = concurrency::create_task([this] { compact(); });
+}
+
+void UserDictionary::compact() {
+  std::lock_guard<std::mutex> compaction_lg(m_compaction_mutex);
+  std::vector<std::string> merged_words;
+  {
+    std::lock_guard<std::mutex> lg(m_mutex);
+    if (!m_loaded)
+      return;
+    if (m_journal_words.empty()) {
+      // journal left from previous session might contain only words already present in the file
+      if (!m_journal)
+        WinApi::delete_file(journal_path().c_str());
+      return;
+    }
+    merged_words = m_journal_words;
+  }
+
+  // file is read again instead of using words in memory, so changes made to it by hand aren't lost
+  std::vector<std::string> words;
+  std::unordered_set<std::string> present;
+  for (auto &word : read_dictionary_words(m_path)) {
+    if (present.insert(word).second)
+      words.push_back(std::move(word));
+  }
+  for (auto &word : merged_words) {
+    if (present.insert(word).second)
+      words.push_back(word);
+  }
+  auto temp_path = m_path + wstring_printf(L".%lu.tmp", GetCurrentProcessId());
+  auto fp = _wfopen(temp_path.c_str(), L"wb");
+  if (!fp)
+    return;
+  bool written = fprintf(fp, "%zu\r\n", words.size()) >= 0;
+  for (auto &word : words)
+    written = written && fprintf(fp, "%s\r\n", word.c_str()) >= 0;
+  written = fclose(fp) == 0 && written;
+  SetFileAttributes(m_path.c_str(), FILE_ATTRIBUTE_NORMAL);
+  if (!written || !MoveFileEx(temp_path.c_str(), m_path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+    // words stay in the journal and will be merged next time
+    WinApi::delete_file(temp_path.c_str());
+    return;
+  }
+
+  std::lock_guard<std::mutex> lg(m_mutex);
+  // words added during the merge stay in the journal until the next one
+  m_journal_words.erase(m_journal_words.begin(), m_journal_words.begin() + merged_words.size());
+  if (m_journal_words.empty()) {
+    if (m_journal) {
+      fclose(m_journal);
+      m_journal = nullptr;
+    }
+    WinApi::delete_file(journal_path().c_str());
+  }
+}
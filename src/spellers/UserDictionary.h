@@ -0,0 +1,53 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#pragma once
+
+// User dictionary file (word count on the first line, then one word per line) kept in memory.
+// Added words are appended to a journal next to the file, which is merged into the file itself
+// in background once it grows and on destruction. Merge rewrites a temporary file and renames it over
+// the original, so the file is never seen partially written and words survive a crash in the journal.
+// Words are stored as bytes in whatever encoding the file uses.
+class UserDictionary {
+public:
+  explicit UserDictionary(std::wstring path);
+  ~UserDictionary();
+  UserDictionary(const UserDictionary &) = delete;
+  UserDictionary &operator=(const UserDictionary &) = delete;
+
+  // Reads file and journal on first call, may be called from any thread
+  std::vector<std::string> words() const;
+  // Returns false if the word couldn't be written to the journal
+  bool add(const std::string &word);
+  // Merges journal into the file synchronously
+  void compact();
+  const std::wstring &path() const { return m_path; }
+  std::wstring journal_path() const;
+
+private:
+  void load() const;
+  void start_compaction();
+
+private:
+  std::wstring m_path;
+  mutable std::mutex m_mutex;
+  mutable bool m_loaded = false;
+  mutable std::vector<std::string> m_words;
+  mutable std::unordered_set<std::string> m_word_set;
+  // words in the journal which are not merged into the file yet
+  mutable std::vector<std::string> m_journal_words;
+  FILE *m_journal = nullptr;
+  std::mutex m_compaction_mutex;
+  std::optional<concurrency::task<void>> m_compaction;
+};
@@ -261,11 +261,13 @@ void ContextMenuHandler::init_suggestions_box(
       m_editor, m_settings)) // If there's no red underline let's do nothing
   {
     suggestion_button.display(false);
+    m_speller_container.active_speller().cancel_suggestions_request();
     return;
   }
 
   TextPosition pos, length;
   if (m_spell_checker.is_word_under_cursor_correct(pos, length)) {
+    m_speller_container.active_speller().cancel_suggestions_request();
     return;
   }
   m_word_under_cursor_length = length;
@@ -307,6 +309,10 @@ void ContextMenuHandler::init_suggestions_box(
              m_settings.data.suggestion_button_size,
              m_settings.data.suggestion_button_size, 1);
   suggestion_button.display(true, false);
+  // Suggestions are computed in background while mouse travels to the button
+  auto word = m_editor.get_mapped_wstring_range(m_word_under_cursor_pos, m_word_under_cursor_pos + m_word_under_cursor_length).str;
+  SpellCheckerHelpers::apply_word_conversions(m_settings, word);
+  m_speller_container.request_suggestions(word);
 }
 
 bool ContextMenuHandler::select_word_under_cursor() {
@@ -326,8 +332,7 @@ std::vector<MenuItem> ContextMenuHandler::select_word_and_get_suggestion_menu_it
 
   select_word_under_cursor();
   std::vector<MenuItem> suggestion_menu_items;
-  m_last_suggestions = m_speller_container.active_speller().get_suggestions(
-      m_last_selected_word.str.c_str());
+  m_last_suggestions = m_speller_container.get_suggestions(m_last_selected_word.str);
   m_last_suggestions.resize(std::min(static_cast<int>(m_last_suggestions.size()), m_settings.data.suggestion_count));
 
   int i = 0;
@@ -520,8 +520,10 @@ const std::vector<std::wstring> &get_indic_names() {
 }
 
 void AdvancedSettingsTab::setup_delimiter_line_edit_visiblity() {
-  ShowWindow(m_delimiter_exclusions_le, m_tokenization_style_cmb.current_data() != TokenizationStyle::by_delimiters ? TRUE : FALSE);
-  ShowWindow(m_h_edit_delimiters, m_tokenization_style_cmb.current_data() == TokenizationStyle::by_delimiters ? TRUE : FALSE);
+  const auto style = m_tokenization_style_cmb.current_data();
+  ShowWindow(m_delimiter_exclusions_le, style == TokenizationStyle::by_non_alphabetic || style == TokenizationStyle::by_non_ansi ? TRUE : FALSE);
+  ShowWindow(m_h_edit_delimiters, style == TokenizationStyle::by_delimiters ? TRUE : FALSE);
+  ShowWindow(m_h_default_delimiters, style != TokenizationStyle::by_word_boundaries ? TRUE : FALSE);
 }
 
 void AdvancedSettingsTab::on_recheck_delay_changed() {
@@ -548,6 +550,7 @@ void AdvancedSettingsTab::on_default_delimiters_clicked() {
   case TokenizationStyle::by_delimiters:
     Edit_SetText(m_h_edit_delimiters, default_delimiters());
     break;
+  case TokenizationStyle::by_word_boundaries:
   case TokenizationStyle::COUNT:
     break;
   }
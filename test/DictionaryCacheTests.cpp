@@ -0,0 +1,176 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "common/Utility.h"
+#include "hunspell/hunspell.hxx"
+#include "spellers/DictionaryCache.h"
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+#include <filesystem>
+#include <fstream>
+#include <psapi.h>
+
+namespace {
+class TempDictionary {
+public:
+  explicit TempDictionary(const std::wstring &name) {
+    m_directory = std::filesystem::temp_directory_path() / (L"DSpellCheckTest_" + name + L"_" + std::to_wstring(GetCurrentProcessId()));
+    std::filesystem::create_directories(m_directory);
+  }
+  ~TempDictionary() {
+    std::error_code ec;
+    std::filesystem::remove_all(m_directory, ec);
+  }
+
+  void write(const std::string &aff, const std::vector<std::string> &words) const {
+    std::ofstream(aff_path(), std::ios::binary) << aff;
+    std::ofstream dic(dic_path(), std::ios::binary);
+    dic << words.size() << "\n";
+    for (auto &word : words)
+      dic << word << "\n";
+  }
+
+  std::wstring aff_path() const { return (m_directory / L"test.aff").wstring(); }
+  std::wstring dic_path() const { return (m_directory / L"test.dic").wstring(); }
+  std::wstring cache_directory() const { return (m_directory / L"cache").wstring(); }
+  std::unique_ptr<Hunspell> load_text() const { return std::make_unique<Hunspell>(to_string(aff_path()).c_str(), to_string(dic_path()).c_str()); }
+  std::unique_ptr<Hunspell> load_image(const DictionaryCache::MappedImage &image) const {
+    return std::make_unique<Hunspell>(to_string(aff_path()).c_str(), image.data(), image.size());
+  }
+
+private:
+  std::filesystem::path m_directory;
+};
+
+const char *test_aff = R"(SET UTF-8
+TRY esianrtolcdugmphbyfvkwz
+PFX A Y 1
+PFX A 0 re .
+SFX B Y 2
+SFX B 0 ed [^y]
+SFX B y ied y
+)";
+
+size_t private_usage() {
+  PROCESS_MEMORY_COUNTERS_EX counters{};
+  GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS *>(&counters), sizeof(counters));
+  return counters.PrivateUsage;
+}
+} // namespace
+
+TEST_CASE("Dictionary cache") {
+  TempDictionary dictionary(L"cache");
+  dictionary.write(test_aff, {"work/AB", "try/B", "test", "document", "Notepad"});
+  DictionaryCache cache(dictionary.cache_directory());
+  auto stamp = DictionaryCache::get_source_stamp(dictionary.aff_path(), dictionary.dic_path());
+  REQUIRE(stamp);
+  CHECK(cache.open(dictionary.dic_path(), *stamp) == nullptr);
+
+  auto text = dictionary.load_text();
+  std::vector<char> image;
+  REQUIRE(text->save_hash_image(image));
+  REQUIRE(cache.save(dictionary.dic_path(), *stamp, image));
+
+  SECTION("Mapped image behaves as parsed dictionary") {
+    auto mapped = cache.open(dictionary.dic_path(), *stamp);
+    REQUIRE(mapped);
+    auto cached = dictionary.load_image(*mapped);
+    CHECK(cached->is_hash_image_loaded());
+    CHECK_FALSE(text->is_hash_image_loaded());
+    // image is used without relocation, so pages of the view are not copied
+    CHECK(memcmp(mapped->data(), image.data(), image.size()) == 0);
+    for (auto word : {"work", "reworked", "tried", "Notepad", "notepad", "tset", "documen"})
+      CHECK(cached->spell(word) == text->spell(word));
+    CHECK(cached->suggest("documen") == text->suggest("documen"));
+    cached->add("plugin");
+    CHECK(cached->spell("plugin"));
+    cached.reset();
+
+    // changes are made to a private copy of the view so the cache file stays intact
+    mapped = cache.open(dictionary.dic_path(), *stamp);
+    REQUIRE(mapped);
+    cached = dictionary.load_image(*mapped);
+    CHECK(cached->is_hash_image_loaded());
+    CHECK_FALSE(cached->spell("plugin"));
+  }
+  SECTION("Image works at any address") {
+    std::vector<char> moved(image.size() + 16);
+    std::copy(image.begin(), image.end(), moved.begin() + 8);
+    auto cached = std::make_unique<Hunspell>(to_string(dictionary.aff_path()).c_str(), moved.data() + 8, image.size());
+    CHECK(cached->is_hash_image_loaded());
+    for (auto word : {"work", "reworked", "tried", "Notepad", "tset"})
+      CHECK(cached->spell(word) == text->spell(word));
+  }
+  SECTION("Cache is rejected after dictionary changes") {
+    dictionary.write(test_aff, {"work/AB", "try/B", "test", "document", "Notepad", "plugin"});
+    auto new_stamp = DictionaryCache::get_source_stamp(dictionary.aff_path(), dictionary.dic_path());
+    REQUIRE(new_stamp);
+    CHECK_FALSE(*new_stamp == *stamp);
+    CHECK(cache.open(dictionary.dic_path(), *new_stamp) == nullptr);
+  }
+  SECTION("Corrupted image is not loaded") {
+    image.resize(image.size() / 2);
+    REQUIRE(cache.save(dictionary.dic_path(), *stamp, image));
+    auto mapped = cache.open(dictionary.dic_path(), *stamp);
+    REQUIRE(mapped);
+    CHECK_FALSE(dictionary.load_image(*mapped)->is_hash_image_loaded());
+  }
+}
+
+TEST_CASE("Dictionary cache file names") {
+  DictionaryCache cache(L"C:\\Cache");
+  // FNV-1a of "c:\dics\en_us.dic" in UTF-16LE
+  CHECK(DictionaryCache::path_hash(L"C:\\Dics\\en_US.dic") == 0xcca34b95895e6ba3ULL);
+  CHECK(cache.cache_path(L"C:\\Dics\\en_US.dic") == L"C:\\Cache\\en_us.dic.cca34b95895e6ba3.cache");
+  CHECK(cache.cache_path(L"c:/dics/EN_US.dic") == cache.cache_path(L"C:\\Dics\\en_US.dic"));
+  CHECK(cache.cache_path(L"C:\\Other\\en_US.dic") != cache.cache_path(L"C:\\Dics\\en_US.dic"));
+}
+
+TEST_CASE("Dictionary cache benchmark", "[.][benchmark]") {
+  TempDictionary dictionary(L"cache_benchmark");
+  std::vector<std::string> words;
+  std::string word = "aaaa";
+  for (int i = 0; i < 400'000; ++i) {
+    for (auto it = word.rbegin(); it != word.rend() && ++*it > 'z'; ++it)
+      *it = 'a';
+    words.push_back(word + (i % 3 == 0 ? "/AB" : ""));
+  }
+  dictionary.write(test_aff, words);
+  DictionaryCache cache(dictionary.cache_directory());
+  auto stamp = DictionaryCache::get_source_stamp(dictionary.aff_path(), dictionary.dic_path());
+  REQUIRE(stamp);
+  std::vector<char> image;
+  REQUIRE(dictionary.load_text()->save_hash_image(image));
+  REQUIRE(cache.save(dictionary.dic_path(), *stamp, image));
+
+  auto usage_before = private_usage();
+  {
+    auto text = dictionary.load_text();
+    WARN("Private memory after parsing .dic: " << (private_usage() - usage_before) / 1024 << " KiB");
+  }
+  usage_before = private_usage();
+  {
+    auto mapped = cache.open(dictionary.dic_path(), *stamp);
+    REQUIRE(mapped);
+    auto cached = dictionary.load_image(*mapped);
+    WARN("Private memory after mapping cache: " << (private_usage() - usage_before) / 1024 << " KiB");
+  }
+
+  BENCHMARK("Parse .dic") { return dictionary.load_text()->spell("abcd"); };
+  BENCHMARK("Map cache") {
+    auto mapped = cache.open(dictionary.dic_path(), *stamp);
+    return dictionary.load_image(*mapped)->spell("abcd");
+  };
+}
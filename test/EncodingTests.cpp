@@ -15,12 +15,18 @@
 #include "MockEditorInterface.h"
 #include "MockSpeller.h"
 #include "TestCommon.h"
+#include "common/utf8.h"
 #include "core/SpellChecker.h"
+#include "hunspell/hunspell.hxx"
+#include "npp/TextUtils.h"
 #include "plugin/Constants.h"
 #include "plugin/Settings.h"
+#include "spellers/HunspellInterface.h"
 #include "spellers/SpellerContainer.h"
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch.hpp>
+#include <random>
 
 TEST_CASE("ANSI") {
   Settings settings;
@@ -66,3 +72,310 @@ TEST_CASE("UTF-8 shenanigans") {
     CHECK(editor.get_next_valid_end_pos(5) == 6);
   }
 }
+
+namespace {
+std::vector<std::wstring> mixed_corpus_words() {
+  std::vector<std::wstring> words;
+  for (int i = 0; i < 100; ++i)
+    for (auto &token : make_delimiter_tokenizer(L"Съешь же ещё этих мягких французских булок, да выпей чаю. The quick brown fox jumps over the lazy dog. "
+                                                L"Ça coûte 10 € — naïve façade",
+                                                L" ,.")
+                           .get_all_tokens())
+      words.emplace_back(token);
+  return words;
+}
+} // namespace
+
+TEST_CASE("UTF-8 dictionary encoding") {
+  DicInfo iconv_dic;
+  iconv_dic.converter = {"UTF-8", "UCS-2LE"};
+  DicInfo utf8_dic;
+  utf8_dic.is_utf8 = true;
+  for (auto &word : mixed_corpus_words())
+    CHECK(utf8_dic.to_dictionary_encoding(word) == iconv_dic.to_dictionary_encoding(word));
+  CHECK(utf8_dic.to_dictionary_encoding(L"\U0001F600") == "\xF0\x9F\x98\x80");
+  CHECK(utf8_dic.to_dictionary_encoding(L"test\xD83D").empty());
+}
+
+TEST_CASE("UTF-8 dictionary encoding benchmark", "[.][benchmark]") {
+  auto words = mixed_corpus_words();
+  DicInfo iconv_dic;
+  iconv_dic.converter = {"UTF-8", "UCS-2LE"};
+  DicInfo utf8_dic;
+  utf8_dic.is_utf8 = true;
+  BENCHMARK("iconv") {
+    size_t length = 0;
+    for (auto &word : words)
+      length += iconv_dic.to_dictionary_encoding(word).length();
+    return length;
+  };
+  BENCHMARK("direct") {
+    size_t length = 0;
+    for (auto &word : words)
+      length += utf8_dic.to_dictionary_encoding(word).length();
+    return length;
+  };
+}
+
+TEST_CASE("Single byte dictionary encoding") {
+  CHECK(SingleByteEncoding::create("UTF-8") == nullptr);
+  for (auto encoding : {"CP1251", "KOI8-R", "ISO-8859-2", "ISO-8859-1"}) {
+    INFO(encoding);
+    DicInfo iconv_dic;
+    iconv_dic.converter = {encoding, "UCS-2LE"};
+    iconv_dic.back_converter = {"UCS-2LE", encoding};
+    DicInfo table_dic;
+    table_dic.single_byte_encoding = SingleByteEncoding::create(encoding);
+    REQUIRE(table_dic.single_byte_encoding != nullptr);
+    for (auto &word : mixed_corpus_words()) {
+      auto encoded = table_dic.to_dictionary_encoding(word);
+      CHECK(encoded == iconv_dic.to_dictionary_encoding(word));
+      CHECK(table_dic.from_dictionary_encoding(encoded) == iconv_dic.from_dictionary_encoding(encoded));
+    }
+    std::string all_bytes;
+    for (int byte = 1; byte < 0x100; ++byte)
+      all_bytes.push_back(static_cast<char>(byte));
+    CHECK(table_dic.from_dictionary_encoding(all_bytes) == iconv_dic.from_dictionary_encoding(all_bytes));
+  }
+}
+
+TEST_CASE("Single byte dictionary encoding benchmark", "[.][benchmark]") {
+  auto words = mixed_corpus_words();
+  DicInfo iconv_dic;
+  iconv_dic.converter = {"CP1251", "UCS-2LE"};
+  DicInfo table_dic;
+  table_dic.single_byte_encoding = SingleByteEncoding::create("CP1251");
+  BENCHMARK("iconv") {
+    size_t length = 0;
+    for (auto &word : words)
+      length += iconv_dic.to_dictionary_encoding(word).length();
+    return length;
+  };
+  BENCHMARK("table") {
+    size_t length = 0;
+    for (auto &word : words)
+      length += table_dic.to_dictionary_encoding(word).length();
+    return length;
+  };
+}
+
+namespace {
+// offsets of characters of mixed Cyrillic/Latin UTF-8 text, as utf8_to_mapped_wstring produces them
+std::vector<TextPosition> mixed_text_offsets(size_t word_count) {
+  std::vector<TextPosition> offsets;
+  TextPosition offset = 0;
+  for (size_t i = 0; i < word_count; ++i) {
+    const TextPosition char_size = i % 3 == 0 ? 1 : 2;
+    for (int j = 0; j < 6; ++j) {
+      offsets.push_back(offset);
+      offset += char_size;
+    }
+    offsets.push_back(offset);
+    ++offset; // space
+  }
+  offsets.push_back(offset);
+  return offsets;
+}
+} // namespace
+
+TEST_CASE("Run-length mapping") {
+  using Mapping = RunLengthMapping<TextPosition>;
+  auto to_vector = [](const Mapping &mapping) {
+    std::vector<TextPosition> result;
+    for (TextPosition i = 0; i < mapping.size(); ++i)
+      result.push_back(mapping[i]);
+    return result;
+  };
+  auto check_lower_bound = [](const Mapping &mapping, const std::vector<TextPosition> &reference) {
+    auto max_value = reference.empty() ? 0 : reference.back();
+    for (TextPosition value = -1; value <= max_value + 1; ++value)
+      if (mapping.lower_bound(value) != std::lower_bound(reference.begin(), reference.end(), value) - reference.begin())
+        return false;
+    return true;
+  };
+
+  std::mt19937 rng(7);
+  for (int iteration = 0; iteration < 300; ++iteration) {
+    std::vector<TextPosition> reference;
+    Mapping mapping;
+    TextPosition value = rng() % 10;
+    TextPosition step = 1;
+    const auto count = rng() % 200;
+    for (size_t i = 0; i < count; ++i) {
+      reference.push_back(value);
+      mapping.push_back(value);
+      // mostly keep the step like in the text of the same script, sometimes repeat offset
+      if (rng() % 6 == 0)
+        step = rng() % 4;
+      value += step;
+    }
+    REQUIRE(to_vector(mapping) == reference);
+    CHECK(check_lower_bound(mapping, reference));
+    // lookups in random order don't benefit from the hint of the last used run but still work with it
+    Mapping::Hint hint, lower_bound_hint;
+    for (int i = 0; i < 20 && !reference.empty(); ++i) {
+      const auto index = static_cast<TextPosition>(rng() % reference.size());
+      CHECK(mapping[index] == reference[index]);
+      CHECK(mapping.at(index, hint) == reference[index]);
+      const auto original = static_cast<TextPosition>(rng() % (value + 2));
+      const auto expected = std::lower_bound(reference.begin(), reference.end(), original) - reference.begin();
+      CHECK(mapping.lower_bound(original) == expected);
+      CHECK(mapping.lower_bound(original, lower_bound_hint) == expected);
+    }
+    Mapping::Hint forward_hint;
+    for (TextPosition index = 0; index < static_cast<TextPosition>(reference.size()); ++index)
+      CHECK(mapping.at(index, forward_hint) == reference[index]);
+
+    const auto from = static_cast<TextPosition>(rng() % (count + 1));
+    const auto to = from + static_cast<TextPosition>(rng() % (count - from + 1));
+    auto slice = mapping.slice(from, to);
+    CHECK(to_vector(slice) == std::vector(reference.begin() + from, reference.begin() + to));
+    CHECK(check_lower_bound(slice, std::vector(reference.begin() + from, reference.begin() + to)));
+
+    auto appended = slice;
+    appended.add_offset(value);
+    appended.append(mapping);
+    auto appended_reference = std::vector(reference.begin() + from, reference.begin() + to);
+    for (auto &offset : appended_reference)
+      offset += value;
+    appended_reference.insert(appended_reference.end(), reference.begin(), reference.end());
+    CHECK(to_vector(appended) == appended_reference);
+
+    mapping.truncate(to);
+    reference.resize(to);
+    CHECK(to_vector(mapping) == reference);
+    mapping.push_back(value + 100);
+    reference.push_back(value + 100);
+    CHECK(to_vector(mapping) == reference);
+  }
+
+  CHECK(Mapping::identity(1 << 20).run_count() == 1);
+  auto offsets = mixed_text_offsets(1000);
+  Mapping mixed;
+  for (auto offset : offsets)
+    mixed.push_back(offset);
+  CHECK(to_vector(mixed) == offsets);
+  // 7 characters per word are stored in a couple of runs
+  CHECK(mixed.run_count() <= 2000);
+}
+
+TEST_CASE("Run-length mapping benchmark", "[.][benchmark]") {
+  auto offsets = mixed_text_offsets(100000);
+  RunLengthMapping<TextPosition> mapping;
+  for (auto offset : offsets)
+    mapping.push_back(offset);
+  WARN("vector: " << offsets.size() * sizeof(TextPosition) << " bytes, runs: " << mapping.run_count() * 3 * sizeof(TextPosition) << " bytes");
+  const auto size = static_cast<TextPosition>(offsets.size());
+  BENCHMARK("to original, vector") {
+    TextPosition sum = 0;
+    for (TextPosition i = 0; i < size; i += 3)
+      sum += offsets[i];
+    return sum;
+  };
+  BENCHMARK("to original, runs") {
+    TextPosition sum = 0;
+    RunLengthMapping<TextPosition>::Hint hint;
+    for (TextPosition i = 0; i < size; i += 3)
+      sum += mapping.at(i, hint);
+    return sum;
+  };
+  BENCHMARK("from original, vector") {
+    TextPosition sum = 0;
+    for (TextPosition i = 0; i < offsets.back(); i += 3)
+      sum += std::lower_bound(offsets.begin(), offsets.end(), i) - offsets.begin();
+    return sum;
+  };
+  BENCHMARK("from original, runs") {
+    TextPosition sum = 0;
+    RunLengthMapping<TextPosition>::Hint hint;
+    for (TextPosition i = 0; i < offsets.back(); i += 3)
+      sum += mapping.lower_bound(i, hint);
+    return sum;
+  };
+}
+
+namespace {
+// Previous implementation decoding one character at a time, serves as a reference for valid text
+MappedWstring per_character_utf8_to_mapped_wstring(std::string_view str) {
+  if (str.empty())
+    return {};
+  MappedWstring result;
+  size_t pos = 0;
+  while (pos < str.size() && utf8_is_cont(str[pos]))
+    ++pos;
+  while (pos < str.size()) {
+    const auto length = static_cast<size_t>(utf8_symbol_len(str[pos]));
+    auto code_point = static_cast<char32_t>(static_cast<unsigned char>(str[pos]) & (length == 1 ? 0x7F : 0x7F >> length));
+    for (size_t i = 1; i < length; ++i)
+      code_point = (code_point << 6) | (str[pos + i] & 0x3F);
+    result.mapping.push_back(static_cast<TextPosition>(pos));
+    result.str.push_back(static_cast<wchar_t>(code_point));
+    pos += length;
+  }
+  result.mapping.push_back(static_cast<TextPosition>(pos));
+  return result;
+}
+
+std::vector<TextPosition> mapping_values(const MappedWstring &str) {
+  std::vector<TextPosition> values;
+  for (TextPosition i = 0; i < str.mapping.size(); ++i)
+    values.push_back(str.mapping[i]);
+  return values;
+}
+
+std::string random_utf8_text(std::mt19937 &rng, size_t character_count) {
+  // ASCII, Cyrillic and 3-byte characters, long ASCII runs for the vectorized part
+  const std::string_view samples[] = {"a", "Z", " ", "\n", "0", "the quick brown fox jumps ", "б", "Ж", "ё", "€", "中", "—"};
+  std::string text;
+  for (size_t i = 0; i < character_count; ++i)
+    text += samples[rng() % std::size(samples)];
+  return text;
+}
+} // namespace
+
+TEST_CASE("UTF-8 decoding") {
+  SECTION("Same as per character decoding for valid text") {
+    std::mt19937 rng(11);
+    for (int i = 0; i < 500; ++i) {
+      auto text = random_utf8_text(rng, rng() % 100);
+      // start in the middle of a character sometimes
+      auto str = std::string_view(text).substr(text.empty() ? 0 : rng() % std::min<size_t>(text.size(), 3));
+      auto decoded = utf8_to_mapped_wstring(str);
+      auto reference = per_character_utf8_to_mapped_wstring(str);
+      CHECK(decoded.str == reference.str);
+      CHECK(mapping_values(decoded) == mapping_values(reference));
+    }
+  }
+  SECTION("Invalid sequences") {
+    auto check = [](std::string_view str, std::wstring_view expected, std::vector<TextPosition> expected_mapping) {
+      auto decoded = utf8_to_mapped_wstring(str);
+      CHECK(decoded.str == expected);
+      CHECK(mapping_values(decoded) == expected_mapping);
+    };
+    // leading continuation bytes are skipped
+    check("\x80\xBF" "abc", L"abc", {2, 3, 4, 5});
+    // broken sequence doesn't swallow characters after it
+    check("a\xE0" "bc", L"a\uFFFDbc", {0, 1, 2, 3, 4});
+    check("ab\xD0", L"ab\uFFFD", {0, 1, 2, 3});
+    // overlong form and encoded surrogate
+    check("\xC0\xAF", L"\uFFFD\uFFFD", {0, 1, 2});
+    check("\xED\xA0\x80", L"\uFFFD\uFFFD\uFFFD", {0, 1, 2, 3});
+    check("\xF4\x90\x80\x80", L"\uFFFD\uFFFD\uFFFD\uFFFD", {0, 1, 2, 3, 4});
+    check("\xF0\x9F\x98", L"\uFFFD", {0, 3});
+  }
+  SECTION("Characters outside of BMP") {
+    auto decoded = utf8_to_mapped_wstring("a\xF0\x9F\x98\x80" "b");
+    CHECK(decoded.str == L"a\U0001F600b");
+    if (sizeof(wchar_t) == 2)
+      CHECK(mapping_values(decoded) == std::vector<TextPosition>{0, 1, 1, 5, 6});
+    else
+      CHECK(mapping_values(decoded) == std::vector<TextPosition>{0, 1, 5, 6});
+  }
+}
+
+TEST_CASE("UTF-8 decoding benchmark", "[.][benchmark]") {
+  std::mt19937 rng(11);
+  auto text = random_utf8_text(rng, 1 << 18);
+  BENCHMARK("per character") { return per_character_utf8_to_mapped_wstring(text).str.size(); };
+  BENCHMARK("vectorized") { return utf8_to_mapped_wstring(text).str.size(); };
+}
@@ -99,3 +99,70 @@ TEST_CASE("Language Styles") {
     CHECK(editor.get_underlined_words(spell_check_indicator_id).empty());
   }
 }
+
+TEST_CASE("Style changes inside checked lines") {
+  Settings settings;
+  settings.data.speller_language[SpellerId::aspell] = L"English";
+  settings.data.check_comments = true;
+  auto speller = std::make_unique<MockSpeller>(settings);
+  setup_speller(*speller);
+  MockEditorInterface editor;
+  TARGET_VIEW_BLOCK(editor, 0);
+  editor.open_virtual_document(L"test.txt", L"test abcdef");
+  SpellerContainer sp_container(&settings, std::move(speller));
+  SpellChecker sc(&settings, editor, sp_container);
+  editor.set_lexer(SCLEX_CPP);
+  editor.make_all_visible();
+
+  // line start keeps its style while the rest of the line is restyled
+  editor.set_whole_text_style(SCE_C_COMMENT);
+  editor.set_text_style(5, 11, SCE_C_GLOBALCLASS);
+  sc.recheck_visible_both_views();
+  CHECK(editor.get_underlined_words(spell_check_indicator_id).empty());
+  editor.set_text_style(5, 11, SCE_C_COMMENT);
+  sc.recheck_visible_both_views();
+  CHECK(editor.get_underlined_words(spell_check_indicator_id) == std::vector<std::string>{"abcdef"});
+
+  editor.set_current_indicator(URL_INDIC);
+  editor.indicator_fill_range(5, 11);
+  sc.recheck_visible_both_views();
+  CHECK(editor.get_underlined_words(spell_check_indicator_id).empty());
+  editor.set_current_indicator(URL_INDIC);
+  editor.indicator_clear_range(5, 11);
+  sc.recheck_visible_both_views();
+  CHECK(editor.get_underlined_words(spell_check_indicator_id) == std::vector<std::string>{"abcdef"});
+}
+
+TEST_CASE("Lines restyled by modification") {
+  Settings settings;
+  settings.data.speller_language[SpellerId::aspell] = L"English";
+  settings.data.check_comments = true;
+  auto speller = std::make_unique<MockSpeller>(settings);
+  setup_speller(*speller);
+  MockEditorInterface editor;
+  TARGET_VIEW_BLOCK(editor, 0);
+  editor.open_virtual_document(L"test.txt", L"test test\nabcdef\ntest\n");
+  SpellerContainer sp_container(&settings, std::move(speller));
+  SpellChecker sc(&settings, editor, sp_container);
+  editor.set_lexer(SCLEX_CPP);
+  editor.make_all_visible();
+  editor.set_whole_text_style(SCE_C_GLOBALCLASS);
+  sc.recheck_visible_both_views();
+  CHECK(editor.get_underlined_words(spell_check_indicator_id).empty());
+
+  // opening a comment in the first line turns the following lines into comment as well
+  editor.replace_text(0, 0, "/*");
+  editor.set_whole_text_style(SCE_C_COMMENT);
+  sc.on_text_modified(0, 2, true);
+  sc.recheck_modified();
+  CHECK(editor.get_underlined_words(spell_check_indicator_id) == std::vector<std::string>{"abcdef"});
+
+  // lines which weren't restyled are taken from the line cache
+  auto misses = sc.line_cache().miss_count();
+  editor.replace_text(0, 2, "  ");
+  sc.on_text_modified(0, 2, false);
+  sc.on_text_modified(0, 2, true);
+  sc.recheck_modified();
+  CHECK(sc.line_cache().miss_count() - misses == 1);
+  CHECK(editor.get_underlined_words(spell_check_indicator_id) == std::vector<std::string>{"abcdef"});
+}
@@ -113,6 +113,7 @@ void MockEditorInterface::set_indicator_foreground(
 
 void MockEditorInterface::set_current_indicator(
     int indicator_index) {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return;
@@ -123,6 +124,7 @@ void MockEditorInterface::set_current_indicator(
 
 void MockEditorInterface::indicator_fill_range(TextPosition from,
                                                TextPosition to) {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return;
@@ -130,10 +132,13 @@ void MockEditorInterface::indicator_fill_range(TextPosition from,
   if (to >= static_cast<int>(s.size()))
     s.resize(to + 1);
   std::fill(s.begin() + from, s.begin() + to, true);
+  if (on_indicator_changed)
+    on_indicator_changed(from, to - from);
 }
 
 void MockEditorInterface::indicator_clear_range(TextPosition from,
                                                 TextPosition to) {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return;
@@ -141,9 +146,12 @@ void MockEditorInterface::indicator_clear_range(TextPosition from,
   if (to >= static_cast<TextPosition>(s.size()))
     s.resize(to + 1);
   std::fill(s.begin() + from, s.begin() + to, false);
+  if (on_indicator_changed)
+    on_indicator_changed(from, to - from);
 }
 
 int MockEditorInterface::get_indicator_value_at(int indicator_id, TextPosition position) const {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return FALSE;
@@ -153,6 +161,32 @@ int MockEditorInterface::get_indicator_value_at(int indicator_id, TextPosition p
   return s[position];
 }
 
+std::vector<int> MockEditorInterface::get_styles(TextPosition from, TextPosition to) const {
+  count_message(__func__);
+  auto doc = active_document();
+  if (!doc || from >= to)
+    return {};
+  return {doc->cur.style.begin() + from, doc->cur.style.begin() + to};
+}
+
+std::vector<std::array<TextPosition, 2>> MockEditorInterface::get_indicator_runs(int indicator_id, TextPosition from, TextPosition to) const {
+  count_message(__func__);
+  auto doc = active_document();
+  if (!doc)
+    return {};
+  auto &s = doc->indicator_info[indicator_id].set_for;
+  std::vector<std::array<TextPosition, 2>> runs;
+  for (auto pos = from; pos < std::min(to, static_cast<TextPosition>(s.size())); ++pos) {
+    if (!s[pos])
+      continue;
+    if (!runs.empty() && runs.back()[1] == pos)
+      ++runs.back()[1];
+    else
+      runs.push_back({pos, pos + 1});
+  }
+  return runs;
+}
+
 int MockEditorInterface::active_view() const {
   return static_cast<int>(m_active_view);
 }
@@ -227,6 +261,7 @@ TextPosition MockEditorInterface::get_line_end_position(
 }
 
 int MockEditorInterface::get_lexer() const {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return 0;
@@ -249,6 +284,7 @@ TextPosition MockEditorInterface::get_selection_end() const {
 
 int MockEditorInterface::get_style_at(
     TextPosition position) const {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return -1;
@@ -446,12 +482,22 @@ std::wstring MockEditorInterface::get_full_current_path() const {
 
 std::string MockEditorInterface::get_text_range(TextPosition from,
                                                 TextPosition to) const {
+  count_message(__func__);
   auto doc = active_document();
   if (!doc)
     return "";
   return doc->cur.data.substr(from, to - from);
 }
 
+std::string_view MockEditorInterface::get_text_range_view(TextPosition from,
+                                                          TextPosition to) const {
+  count_message(__func__);
+  auto doc = active_document();
+  if (!doc)
+    return {};
+  return std::string_view(doc->cur.data).substr(from, to - from);
+}
+
 std::string
 MockEditorInterface::get_active_document_text() const {
   auto doc = active_document();
@@ -563,6 +609,17 @@ void MockEditorInterface::set_visible_lines(ptrdiff_t first_visible_line, ptrdif
   doc->visible_lines = {first_visible_line, last_visible_line};
 }
 
+void MockEditorInterface::set_line_folded(TextPosition line, bool folded) {
+  auto doc = active_document();
+  if (!doc)
+    return;
+
+  if (folded)
+    doc->folded_lines.insert(line);
+  else
+    doc->folded_lines.erase(line);
+}
+
 void MockEditorInterface::set_lexer(int lexer) {
   auto doc = active_document();
   if (!doc)
@@ -577,6 +634,13 @@ void MockEditorInterface::set_whole_text_style(int style) {
   std::fill(doc->cur.style.begin(), doc->cur.style.end(), style);
 }
 
+void MockEditorInterface::set_text_style(TextPosition from, TextPosition to, int style) {
+  auto doc = active_document();
+  if (!doc)
+    return;
+  std::fill(doc->cur.style.begin() + from, doc->cur.style.begin() + to, style);
+}
+
 void MockEditorInterface::set_codepage(
     EditorCodepage codepage) {
   auto doc = active_document();
@@ -616,8 +680,11 @@ void MockEditorInterface::undo() {
   }
 }
 
-bool MockEditorInterface::is_line_visible(TextPosition /*line*/) const {
-  return true;
+bool MockEditorInterface::is_line_visible(TextPosition line) const {
+  auto doc = active_document();
+  if (!doc)
+    return true;
+  return !doc->folded_lines.contains(line);
 }
 
 TextPosition MockEditorInterface::find_next(TextPosition from_position, const char *needle) {
@@ -731,3 +798,28 @@ MockEditorInterface::active_document() const {
     return nullptr;
   return &m_documents[m_target_view][m_active_document_index[m_target_view]];
 }
+
+void MockEditorInterface::set_message_counting(bool enabled) {
+  m_message_counting = enabled;
+}
+
+int MockEditorInterface::get_message_count(std::string_view function_name) const {
+  auto it = m_message_counts.find(function_name);
+  return it != m_message_counts.end() ? it->second : 0;
+}
+
+int MockEditorInterface::get_total_message_count() const {
+  int count = 0;
+  for (auto &[name, function_count] : m_message_counts)
+    count += function_count;
+  return count;
+}
+
+void MockEditorInterface::reset_message_counts() {
+  m_message_counts.clear();
+}
+
+void MockEditorInterface::count_message(const char *function_name) const {
+  if (m_message_counting)
+    ++m_message_counts[function_name];
+}
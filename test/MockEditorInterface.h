@@ -17,6 +17,8 @@
 #include "common/enum_array.h"
 #include "npp/EditorInterface.h"
 
+#include <functional>
+#include <map>
 #include <set>
 #include <vector>
 
@@ -35,6 +37,7 @@ public:
   int lexer = 0;
   int current_indicator = 0;
   std::array<TextPosition, 2> visible_lines = {0, 30};
+  std::set<TextPosition> folded_lines;
 
   struct State {
     std::string data;
@@ -68,6 +71,8 @@ public:
   void indicator_fill_range(TextPosition from, TextPosition to) override;
   void indicator_clear_range(TextPosition from, TextPosition to) override;
   int get_indicator_value_at(int indicator_id, TextPosition position) const override;
+  std::vector<int> get_styles(TextPosition from, TextPosition to) const override;
+  std::vector<std::array<TextPosition, 2>> get_indicator_runs(int indicator_id, TextPosition from, TextPosition to) const override;
   EditorCodepage get_encoding() const override;
   TextPosition get_current_pos() const override;
   int get_current_line_number() const override;
@@ -108,6 +113,8 @@ public:
   std::wstring get_full_current_path() const override;
   std::string get_text_range(TextPosition from,
                              TextPosition to) const override;
+  std::string_view get_text_range_view(TextPosition from,
+                                       TextPosition to) const override;
   std::string get_active_document_text() const override;
   TextPosition char_position_from_point(const POINT &pnt) const override;
   RECT editor_rect() const override;
@@ -121,8 +128,10 @@ public:
   std::vector<std::string> get_underlined_words(int indicator_id) const;
   void make_all_visible();
   void set_visible_lines(ptrdiff_t first_visible_line, ptrdiff_t last_visible_line);
+  void set_line_folded(TextPosition line, bool folded);
   void set_lexer(int lexer);
   void set_whole_text_style(int style);
+  void set_text_style(TextPosition from, TextPosition to, int style);
   void set_codepage(EditorCodepage codepage);
   void delete_range(TextPosition start, TextPosition length) override;
   void begin_undo_action() override;
@@ -142,8 +151,16 @@ public:
   std::optional<POINT> get_mouse_cursor_pos() const override;
   void set_mouse_cursor_pos(const std::optional<POINT> &pos);
   std::wstring get_editor_directory() const override;
+  // Message counting mode, counts calls of editor functions which send messages to Scintilla by their names
+  void set_message_counting(bool enabled);
+  int get_message_count(std::string_view function_name) const;
+  int get_total_message_count() const;
+  void reset_message_counts();
+  // Called after indicators are filled or cleared, the same way Scintilla synchronously reports SC_MOD_CHANGEINDICATOR
+  std::function<void(TextPosition position, TextPosition length)> on_indicator_changed;
 
 private:
+  void count_message(const char *function_name) const;
   void set_target_view(int view_index) const override;
   int get_target_view() const override;
   const MockedDocumentInfo *active_document() const;
@@ -162,4 +179,6 @@ private:
   mutable int m_target_view = -1;
   RECT m_editor_rect;
   std::optional<POINT> m_cursor_pos;
+  bool m_message_counting = false;
+  mutable std::map<std::string, int, std::less<>> m_message_counts;
 };
@@ -55,6 +55,7 @@ void MockSpeller::set_multiple_languages(
 
 std::vector<std::wstring>
 MockSpeller::get_suggestions(const wchar_t *word) const {
+  ++m_suggestions_call_count;
   std::vector<std::vector<std::wstring>> v;
   auto process_lang = [&](const std::wstring &lang) {
     auto it = m_sugg_dict.find(lang);
@@ -89,6 +90,7 @@ void MockSpeller::set_suggestions_dict(const SuggestionsDict &dict) {
 }
 
 bool MockSpeller::check_word(const WordForSpeller &word) const {
+  ++m_checked_word_count;
   switch (m_speller_mode) {
   case SpellerMode::SingleLanguage: {
     auto it = m_inner_dict.find(m_current_lang);
@@ -44,6 +44,9 @@ public:
 
   bool check_word(const WordForSpeller &word) const override;
   void set_working(bool working);
+  int get_checked_word_count() const { return m_checked_word_count; }
+  void reset_checked_word_count() { m_checked_word_count = 0; }
+  int get_suggestions_call_count() const { return m_suggestions_call_count; }
 
   std::vector<bool> check_words(const std::vector<WordForSpeller> &words) const override;
 private:
@@ -54,5 +57,7 @@ private:
   Dict m_inner_dict;
   SuggestionsDict m_sugg_dict;
   bool m_working = true;
+  mutable int m_checked_word_count = 0;
+  mutable int m_suggestions_call_count = 0;
   const Settings &m_settings;
 };
@@ -0,0 +1,67 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "common/LinearRegex.h"
+
+#include <catch.hpp>
+#include <regex>
+#include <string>
+
+namespace {
+const std::vector<std::wstring> patterns = {
+  L"", L"abc", L"a|b|", L"[0-9a-fA-F]{6,40}", L"[A-Z]{2,10}-\\d+", L"^\\w+$", L"(?:ab)*c?", L"(a*)*b", L"x{0}y", L"a{2,3}", L"a{2,}",
+  L"[^\\d\\s]+", L"\\W*", L".+", L"a.c", L"(a|ab)(c|bcd)(d*)", L"[-a]+", L"[a-]+", L"\\x41\\u0042", L"[\\w-]+", L"a+?b", L"(x|y|)+z",
+  L"\\.\\*", L"#.*|.*#|[A-Z]{1,5}", L"[а-я]+",
+};
+
+const std::vector<std::wstring> words = {
+  L"", L"abc", L"a", L"b", L"deadbeef", L"DEADBEEF12", L"JIRA-123", L"AB-", L"hello_world", L"ab", L"ababc", L"aaab", L"y", L"aa", L"aaa",
+  L"aaaa", L"xyz", L"  ", L"a-a", L"AB", L"abcd", L"abcdd", L"z", L"xxyz", L".*", L"#ignore", L"ignore#", L"привет", L"Привет", L"--a",
+  L"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab", L"0123456789abcdef0123456789abcdef01234567",
+};
+} // namespace
+
+TEST_CASE("Linear regex") {
+  for (auto &pattern : patterns) {
+    INFO(std::string(pattern.begin(), pattern.end()));
+    auto linear_regex = LinearRegex::compile(pattern);
+    REQUIRE(linear_regex);
+    std::wregex regex(pattern);
+    for (auto &word : words)
+      CHECK(linear_regex->full_match(word) == std::regex_match(word, regex));
+  }
+
+  // these are left to std::wregex
+  for (auto pattern : {L"(a)\\1", L"a(?=b)", L"\\bword", L"[[:alpha:]]+", L"a**", L"(ab", L"a{1001}"})
+    CHECK_FALSE(LinearRegex::compile(pattern));
+}
+
+TEST_CASE("Linear regex benchmark", "[.][benchmark]") {
+  const std::wstring pattern = L"[0-9a-fA-F]{6,40}|[A-Z]{2,10}-\\d+|#.*";
+  auto linear_regex = LinearRegex::compile(pattern);
+  std::wregex regex(pattern);
+  BENCHMARK("std::wregex") {
+    int count = 0;
+    for (auto &word : words)
+      count += std::regex_match(word, regex) ? 1 : 0;
+    return count;
+  };
+  BENCHMARK("LinearRegex") {
+    int count = 0;
+    for (auto &word : words)
+      count += linear_regex->full_match(word) ? 1 : 0;
+    return count;
+  };
+}
@@ -15,12 +15,15 @@
 #include "MockEditorInterface.h"
 #include "MockSpeller.h"
 #include "TestCommon.h"
+#include "core/MisspellingIndex.h"
 #include "core/SpellChecker.h"
 #include "core/SpellCheckerHelpers.h"
 #include "plugin/Constants.h"
 #include "plugin/Settings.h"
+#include "spellers/CachingSpeller.h"
 #include "spellers/SpellerContainer.h"
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch.hpp>
 
 using namespace std::literals;
@@ -441,12 +444,49 @@ test_test
     editor.set_codepage(EditorCodepage::utf8);
   }
 
+  SECTION("Misspelling report") {
+    editor.set_active_document_text(L"wrongword badword\nThis is test document\nBadword abirvalg BADWORD\nabirvalg");
+    auto report = sc.get_misspelling_report(MisspellingReportOrder::by_frequency);
+    REQUIRE(report.size() == 3);
+    CHECK(report[0].word == L"badword");
+    CHECK(report[0].count == 3);
+    CHECK(report[0].first_position == 10);
+    CHECK(report[0].first_line == 0);
+    CHECK(report[1].word == L"abirvalg");
+    CHECK(report[1].count == 2);
+    CHECK(report[1].first_line == 2);
+    CHECK(report[2].word == L"wrongword");
+    CHECK(report[2].count == 1);
+    CHECK(sc.get_misspelling_report_as_string() == L"3\t1\tbadword\n2\t3\tabirvalg\n1\t1\twrongword\n");
+    CHECK(sc.get_all_misspellings_as_string() == L"abirvalg\nbadword\nwrongword\n");
+    editor.set_active_document_text(L"This is test document");
+    CHECK(sc.get_misspelling_report(MisspellingReportOrder::alphabetical).empty());
+  }
+
   SECTION("Bookmarks") {
     editor.set_active_document_text(L"abcdef\ntest\ntest\nkolli");
     sc.mark_lines_with_misspelling();
     CHECK(editor.get_bookmarked_lines() == std::set<size_t> {0, 3});
   }
 
+  SECTION("Whole document chunks") {
+    // long line without line breaks with misspelling crossing the chunk boundary
+    std::wstring text;
+    for (int i = 0; i < (1 << 20) / 5; ++i)
+      text += L"This ";
+    text += L"badword";
+    for (int i = 0; i < 1000; ++i)
+      text += L" This";
+    text += L"\nwrongword\n";
+    editor.set_active_document_text(text);
+    CHECK(sc.get_all_misspellings_as_string() == L"badword\nwrongword\n");
+    sc.mark_lines_with_misspelling();
+    CHECK(editor.get_bookmarked_lines() == std::set<size_t>{0, 1});
+    sc.erase_all_misspellings();
+    CHECK(editor.get_active_document_length() == static_cast<TextPosition>(text.size() - 16));
+    CHECK(sc.get_all_misspellings_as_string().empty());
+  }
+
   SECTION("Leftover settings") {
     editor.set_active_document_text(L"нёмного Ёё");
     sc.recheck_visible_both_views();
@@ -523,7 +563,364 @@ test_test
       CHECK(editor.get_current_pos() == 20);
     }
   }
+  SECTION("Incremental recheck") {
+    std::wstring text = L"wrongword\n";
+    for (int i = 0; i < 20; ++i)
+      text += L"This is test document\n";
+    editor.set_active_document_text(text);
+    editor.make_all_visible();
+    sc.recheck_visible_both_views();
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"wrongword"s});
+
+    auto pos = editor.get_line_start_position(10) + 8;
+    editor.replace_text(pos, pos + 4, "tset");
+    sc.on_text_modified(pos, 4, false);
+    sc.on_text_modified(pos, 4, true);
+    speller_ptr->reset_checked_word_count();
+    auto misses = sc.line_cache().miss_count();
+    sc.recheck_modified();
+    CHECK(sc.line_cache().miss_count() - misses == 1);
+    // other words of the line are known by verdict cache
+    CHECK(speller_ptr->get_checked_word_count() == 1);
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"wrongword"s, "tset"s});
+
+    // nothing was modified since the last pass - whole visible area is rechecked, all lines are cached already
+    speller_ptr->reset_checked_word_count();
+    sc.recheck_modified();
+    CHECK(speller_ptr->get_checked_word_count() == 0);
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"wrongword"s, "tset"s});
+
+    editor.set_visible_lines(0, 5);
+    pos = editor.get_line_start_position(15);
+    editor.replace_text(pos, pos + 4, "Thsi");
+    sc.on_text_modified(pos, 4, false);
+    sc.on_text_modified(pos, 4, true);
+    speller_ptr->reset_checked_word_count();
+    sc.recheck_modified();
+    CHECK(speller_ptr->get_checked_word_count() == 0);
+
+    // folded lines between modified ones aren't checked, so their underlines stay
+    editor.set_active_document_text(L"This is test document\nwrongword\nThis is test document\n");
+    editor.make_all_visible();
+    sc.recheck_visible_both_views();
+    editor.set_line_folded(1, true);
+    for (auto line : {0, 2}) {
+      pos = editor.get_line_start_position(line);
+      editor.replace_text(pos, pos + 4, "Thsi");
+      sc.on_text_modified(pos, 4, false);
+      sc.on_text_modified(pos, 4, true);
+    }
+    sc.recheck_modified();
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"Thsi"s, "wrongword"s, "Thsi"s});
+  }
+  SECTION("Line cache") {
+    std::wstring text = L"wrongword\n";
+    for (int i = 0; i < 20; ++i)
+      text += L"This is test document\n";
+    editor.set_active_document_text(text);
+    editor.set_visible_lines(0, 10);
+    sc.recheck_visible_both_views();
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"wrongword"s});
+
+    // scrolling down and back up checks only lines which weren't seen before
+    auto misses = sc.line_cache().miss_count();
+    editor.set_visible_lines(5, 15);
+    sc.recheck_visible_on_active_view();
+    CHECK(sc.line_cache().miss_count() - misses == 5);
+    speller_ptr->reset_checked_word_count();
+    auto hits = sc.line_cache().hit_count();
+    editor.set_visible_lines(0, 10);
+    sc.recheck_visible_on_active_view();
+    CHECK(speller_ptr->get_checked_word_count() == 0);
+    CHECK(sc.line_cache().hit_count() - hits == 11);
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"wrongword"s});
+
+    // changed line is checked again
+    editor.replace_text(0, 5, "right");
+    speller_ptr->reset_checked_word_count();
+    sc.recheck_visible_on_active_view();
+    CHECK(speller_ptr->get_checked_word_count() == 1);
+    CHECK(editor.get_underlined_words(indicator_id) == std::vector{"rightword"s});
+
+    // settings and speller changes invalidate everything, all visible lines are checked by the speller again
+    misses = sc.line_cache().miss_count();
+    speller_ptr->reset_checked_word_count();
+    settings.modify();
+    sc.recheck_visible_on_active_view();
+    CHECK(sc.line_cache().miss_count() - misses == 11);
+    CHECK(speller_ptr->get_checked_word_count() > 0);
+    misses = sc.line_cache().miss_count();
+    speller_ptr->reset_checked_word_count();
+    sp_container.speller_status_changed();
+    sc.recheck_visible_on_active_view();
+    CHECK(sc.line_cache().miss_count() - misses == 11);
+    CHECK(speller_ptr->get_checked_word_count() > 0);
+  }
+  SECTION("Minimal underline updates") {
+    std::wstring text;
+    for (int i = 0; i < 10; ++i)
+      text += L"wrongword This is test document\n";
+    editor.set_active_document_text(text);
+    editor.make_all_visible();
+    editor.on_indicator_changed = [&](TextPosition position, TextPosition length) { sc.on_indicator_changed(position, length); };
+    sc.recheck_visible_both_views();
+    CHECK(editor.get_underlined_words(indicator_id).size() == 10);
+
+    // nothing has changed, editor isn't even asked about applied underlines
+    editor.set_message_counting(true);
+    sc.recheck_visible_on_active_view();
+    CHECK(editor.get_message_count("get_indicator_value_at") == 0);
+    CHECK(editor.get_message_count("set_current_indicator") == 0);
+    CHECK(editor.get_message_count("indicator_fill_range") == 0);
+    CHECK(editor.get_message_count("indicator_clear_range") == 0);
+
+    auto pos = editor.get_line_start_position(3) + 10;
+    editor.replace_text(pos, pos + 4, "Tihs");
+    sc.on_text_modified(pos, 4, false);
+    sc.on_text_modified(pos, 4, true);
+    editor.reset_message_counts();
+    sc.recheck_modified();
+    CHECK(editor.get_message_count("set_current_indicator") == 1);
+    CHECK(editor.get_message_count("indicator_clear_range") == 1);
+    CHECK(editor.get_message_count("indicator_fill_range") == 1);
+    // our own operations reported by the editor don't make the next pass apply them again
+    editor.reset_message_counts();
+    sc.recheck_visible_on_active_view();
+    CHECK(editor.get_message_count("indicator_clear_range") == 0);
+    CHECK(editor.get_message_count("indicator_fill_range") == 0);
+    editor.set_message_counting(false);
+    CHECK(editor.get_underlined_words(indicator_id).size() == 11);
+
+    // underlines removed behind our back are restored once it's reported
+    auto length = editor.get_active_document_length();
+    editor.clear_indicator_info();
+    sc.on_indicator_changed(0, length);
+    sc.recheck_visible_on_active_view();
+    CHECK(editor.get_underlined_words(indicator_id).size() == 11);
+
+    // reported changes made by ourselves keep the model
+    editor.set_message_counting(true);
+    editor.reset_message_counts();
+    sc.on_indicator_changed(0, length);
+    sc.recheck_visible_on_active_view();
+    CHECK(editor.get_message_count("indicator_fill_range") == 0);
+    CHECK(editor.get_message_count("indicator_clear_range") == 0);
+    editor.set_message_counting(false);
+
+    // nothing is remembered about closed documents
+    sc.on_document_closed(editor.get_full_current_path());
+    editor.clear_indicator_info();
+    sc.recheck_visible_on_active_view();
+    CHECK(editor.get_underlined_words(indicator_id).size() == 11);
+  }
+  SECTION("Text access without copies") {
+    editor.set_active_document_text(L"wrongword This is test document\nПривет badword\n");
+    editor.make_all_visible();
+    editor.set_message_counting(true);
+    sc.recheck_visible_both_views();
+    sc.find_next_mistake();
+    sc.find_prev_mistake();
+    CHECK(sc.get_all_misspellings_as_string() == L"badword\nwrongword\nПривет\n");
+    CHECK(editor.get_message_count("get_text_range") == 0);
+    CHECK(editor.get_message_count("get_text_range_view") > 0);
+  }
+  SECTION("Bulk style fetch") {
+    // number of editor calls per visible screen recheck shouldn't depend on the number of words
+    auto count_recheck_messages = [&](int words_per_line) {
+      std::wstring text;
+      for (int i = 0; i < 20; ++i) {
+        for (int j = 0; j < words_per_line; ++j)
+          text += j % 2 == 0 ? L"wrongword " : L"test ";
+        text += L'\n';
+      }
+      editor.set_active_document_text(text);
+      editor.make_all_visible();
+      editor.set_message_counting(true);
+      editor.reset_message_counts();
+      sc.recheck_visible_on_active_view();
+      editor.set_message_counting(false);
+      CHECK(editor.get_message_count("get_style_at") == 0);
+      CHECK(editor.get_message_count("get_indicator_value_at") == 0);
+      CHECK(editor.get_message_count("get_styles") == 1);
+      CHECK(editor.get_message_count("get_indicator_runs") == 1);
+      return editor.get_total_message_count() - editor.get_message_count("indicator_fill_range");
+    };
+    CHECK(count_recheck_messages(2) == count_recheck_messages(50));
+  }
+  SECTION("Navigation stops at the first misspelling") {
+    auto queried_word_count = [&] { return sp_container.word_cache_hit_count() + sp_container.word_cache_miss_count(); };
+    std::wstring correct_text;
+    for (int i = 0; i < 500; ++i)
+      correct_text += L"This is test document ";
+    editor.set_active_document_text(L"wrongword " + correct_text);
+    editor.set_selection(0, 0);
+    auto count_before = queried_word_count();
+    sc.find_next_mistake();
+    CHECK(editor.selected_text() == "wrongword");
+    CHECK(queried_word_count() - count_before <= 8);
+
+    auto text = correct_text + L"badword.";
+    editor.set_active_document_text(text);
+    editor.set_selection(static_cast<TextPosition>(text.length()), static_cast<TextPosition>(text.length()));
+    count_before = queried_word_count();
+    sc.find_prev_mistake();
+    CHECK(editor.selected_text() == "badword");
+    CHECK(queried_word_count() - count_before <= 8);
+  }
+  SECTION("Verdict cache") {
+    MockSpeller mock_speller(settings);
+    setup_speller(mock_speller);
+    mock_speller.set_language(L"English");
+    CachingSpeller cached(mock_speller);
+    std::vector<WordForSpeller> words;
+    for (auto word : {L"This", L"is", L"test", L"wrongword", L"test", L"This", L"wrongword"})
+      words.push_back({word, {}});
+    CHECK(cached.check_words(words) == std::vector{true, true, true, false, true, true, false});
+    CHECK(mock_speller.get_checked_word_count() == 4);
+    CHECK(cached.check_words(words) == std::vector{true, true, true, false, true, true, false});
+    CHECK(mock_speller.get_checked_word_count() == 4);
+    CHECK(cached.hit_count() == 10);
+    CHECK(cached.miss_count() == 4);
+    // word followed by dot is a different word for speller
+    words.front().data.ends_with_dot = true;
+    CHECK(cached.check_word(words.front()));
+    CHECK(mock_speller.get_checked_word_count() == 5);
+
+    cached.ignore_all(L"wrongword");
+    cached.check_words(words);
+    CHECK(mock_speller.get_checked_word_count() == 10);
+    cached.add_to_dictionary(L"wrongword");
+    cached.set_language(L"English");
+    cached.set_multiple_languages({L"English"});
+    cached.check_words(words);
+    CHECK(mock_speller.get_checked_word_count() == 15);
+    cached.flush();
+    CHECK(cached.check_words_in_parallel(words) == std::vector{true, true, true, false, true, true, false});
+    CHECK(mock_speller.get_checked_word_count() == 20);
+    // token which ends with dot itself doesn't share the verdict of a word followed by dot
+    cached.check_word({L"This.", {}});
+    CHECK(mock_speller.get_checked_word_count() == 21);
+  }
+  SECTION("Suggestion cache") {
+    auto call_count = [&] { return speller_ptr->get_suggestions_call_count(); };
+    CHECK(sp_container.get_suggestions(L"abcdef") == std::vector<std::wstring>{L"document", L"please"});
+    CHECK(sp_container.get_suggestions(L"abcdef") == std::vector<std::wstring>{L"document", L"please"});
+    CHECK(sp_container.get_suggestions(L"немонго") == std::vector<std::wstring>{L"немного", L"много"});
+    CHECK(call_count() == 2);
+    CHECK(sp_container.suggestion_cache_hit_count() == 1);
+    CHECK(sp_container.suggestion_cache_miss_count() == 2);
+
+    // least recently used word is evicted
+    sp_container.get_suggestions(L"abcdef");
+    for (size_t i = 0; i < SpellerContainer::max_cached_suggestion_count - 1; ++i)
+      sp_container.get_suggestions(L"word" + std::to_wstring(i));
+    CHECK(call_count() == 33);
+    sp_container.get_suggestions(L"abcdef");
+    CHECK(call_count() == 33);
+    sp_container.get_suggestions(L"немонго");
+    CHECK(call_count() == 34);
+
+    // languages are a part of the key
+    settings.data.speller_language[SpellerId::aspell] = L"Russian";
+    sp_container.get_suggestions(L"abcdef");
+    CHECK(call_count() == 35);
+    settings.data.speller_language[SpellerId::aspell] = L"English";
+
+    // speller has just computed suggestions for the word itself, so it's added without asking again
+    sp_container.add_to_dictionary(L"abcdef");
+    CHECK(call_count() == 35);
+    sp_container.get_suggestions(L"abcdef");
+    sp_container.get_suggestions(L"abcdef");
+    CHECK(call_count() == 36);
+    sp_container.get_suggestions(L"немонго");
+    sp_container.get_suggestions(L"abcdef");
+    CHECK(call_count() == 37);
+    // suggestions for the word only came from cache
+    sp_container.add_to_dictionary(L"abcdef");
+    CHECK(call_count() == 38);
+
+    sp_container.get_suggestions(L"abcdef");
+    CHECK(call_count() == 39);
+    sp_container.speller_status_changed();
+    sp_container.get_suggestions(L"abcdef");
+    CHECK(call_count() == 40);
+  }
   SECTION("Not called normally") {
     CHECK_FALSE (SpellCheckerHelpers::is_word_spell_checking_needed(settings, editor, L"", 0));
   }
 }
+
+TEST_CASE("Misspelling index") {
+  using Range = MisspellingIndex::Range;
+  MisspellingIndex index;
+  index.start_building(L"test.txt", 100);
+  CHECK(index.is_building_for(L"test.txt"));
+  CHECK_FALSE(index.is_ready_for(L"test.txt", 100));
+  index.add({10, 15});
+  index.add({20, 25});
+  index.add({50, 55});
+  index.finish_building();
+  CHECK(index.is_ready_for(L"test.txt", 100));
+  CHECK_FALSE(index.is_ready_for(L"other.txt", 100));
+
+  CHECK(index.find_next(0) == Range{10, 15});
+  CHECK(index.find_next(12) == Range{10, 15});
+  CHECK(index.find_next(15) == Range{20, 25});
+  CHECK_FALSE(index.find_next(55));
+  CHECK(index.find_prev(25) == Range{10, 15});
+  CHECK(index.find_prev(26) == Range{20, 25});
+  CHECK_FALSE(index.find_prev(15));
+
+  index.on_text_modified(30, 5, true);
+  CHECK(index.is_ready_for(L"test.txt", 105));
+  CHECK(index.find_next(25) == Range{55, 60});
+  // deletion touching the word removes it until dirty range is rechecked
+  index.on_text_modified(22, 2, false);
+  CHECK(index.size() == 2);
+  CHECK(index.take_dirty_ranges() == std::vector{Range{22, 22}, Range{28, 33}});
+  CHECK(index.take_dirty_ranges().empty());
+  index.replace(20, 40, {{21, 23}});
+  CHECK(index.find_next(15) == Range{21, 23});
+  index.remove({21, 23});
+  CHECK(index.find_next(15) == Range{53, 58});
+
+  // shifts caused by edits at different places are combined lazily
+  index.start_building(L"test.txt", 100);
+  for (TextPosition pos = 0; pos < 100; pos += 10)
+    index.add({pos, pos + 5});
+  index.finish_building();
+  index.on_text_modified(72, 1, true);
+  index.on_text_modified(12, 2, true);
+  index.on_text_modified(45, 3, false);
+  CHECK(index.size() == 7);
+  CHECK(index.find_next(5) == Range{22, 27});
+  CHECK(index.find_next(40) == Range{49, 54});
+  CHECK(index.find_prev(80) == Range{59, 64});
+  CHECK(index.find_next(85) == Range{90, 95});
+  index.remove({49, 54});
+  CHECK(index.find_next(40) == Range{59, 64});
+
+  index.start_building(L"test.txt", 100);
+  index.on_text_modified(0, 1, true);
+  CHECK(index.is_empty());
+}
+
+TEST_CASE("Capital letter filters benchmark", "[.][benchmark]") {
+  Settings settings;
+  settings.data.ignore_having_a_capital = true;
+  settings.data.ignore_all_capital = true;
+  MockEditorInterface editor;
+  TARGET_VIEW_BLOCK(editor, 0);
+  editor.open_virtual_document(L"test.txt", L"text");
+  std::vector<std::wstring> words;
+  for (int i = 0; i < 10000; ++i)
+    for (auto word : {L"lowercase", L"Capitalized", L"UPPERCASE", L"camelCase", L"строчные", L"Заглавные", L"ПРОПИСНЫЕ"})
+      words.emplace_back(word);
+  BENCHMARK("is_word_spell_checking_needed") {
+    size_t count = 0;
+    for (auto &word : words)
+      if (SpellCheckerHelpers::is_word_spell_checking_needed(settings, editor, word, 0))
+        ++count;
+    return count;
+  };
+}
@@ -13,9 +13,14 @@
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 
 #include "common/string_utils.h"
+#include "common/CaseData.h"
+#include "common/WordBreakData.h"
 #include "network/UrlHelpers.h"
+#include "plugin/Settings.h"
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch.hpp>
+#include <random>
 #include <string>
 
 using namespace std::literals;
@@ -64,6 +69,56 @@ TEST_CASE("string_case") {
   REQUIRE_THROWS_AS(apply_case_type (str, static_cast<string_case_type> (300)), std::invalid_argument);
 }
 
+TEST_CASE("Case tables") {
+  SECTION("Characters") {
+    CHECK(is_upper(L'A'));
+    CHECK(is_lower(L'a'));
+    CHECK(make_lower(L'A') == L'a');
+    CHECK(make_upper(L'a') == L'A');
+    CHECK(make_upper(L'я') == L'Я');
+    CHECK(make_lower(L'Я') == L'я');
+    CHECK(is_upper(L'Ё'));
+    CHECK(is_lower(L'ß'));
+    CHECK(make_upper(L'ß') == L'ß');
+    CHECK(make_lower(L'\x0130') == L'i');
+    // titlecase letter is neither upper nor lower but has both mappings
+    CHECK(!is_upper(L'\x01C5'));
+    CHECK(!is_lower(L'\x01C5'));
+    CHECK(make_upper(L'\x01C5') == L'\x01C4');
+    CHECK(make_lower(L'\x01C5') == L'\x01C6');
+    // Roman numerals have Uppercase property without being letters
+    CHECK(is_upper(L'\x2160'));
+    CHECK(make_lower(L'\x2160') == L'\x2170');
+    for (auto c : {L'1', L' ', L'-', L'\x4E2D', L'\xD800', L'\xFFFF'}) {
+      CHECK(!is_upper(c));
+      CHECK(!is_lower(c));
+      CHECK(make_upper(c) == c);
+      CHECK(make_lower(c) == c);
+    }
+    CHECK(get_string_case_type(L"Ёлка") == string_case_type::title);
+    CHECK(get_string_case_type(L"ΣΟΦΙΑ") == string_case_type::upper);
+  }
+
+  SECTION("Lookup matches ranges") {
+    wchar_t next = 0;
+    auto check_range = [](wchar_t first, wchar_t last, const CaseRecord &record) {
+      for (auto c = first; c <= last; ++c) {
+        if (is_upper(c) != (record.kind == CaseKind::upper) || is_lower(c) != (record.kind == CaseKind::lower) ||
+            make_upper(c) != static_cast<wchar_t>(c + record.to_upper) || make_lower(c) != static_cast<wchar_t>(c + record.to_lower))
+          return false;
+      }
+      return true;
+    };
+    for (auto &range : case_data::ranges) {
+      if (range.first > next)
+        CHECK(check_range(next, static_cast<wchar_t>(range.first - 1), case_data::records[0]));
+      CHECK(check_range(static_cast<wchar_t>(range.first), static_cast<wchar_t>(range.last), case_data::records[range.record]));
+      next = static_cast<wchar_t>(range.last + 1);
+    }
+    CHECK(check_range(next, L'\xFFFE', case_data::records[0]));
+  }
+}
+
 TEST_CASE("CamelCase") {
   std::wstring s = L"TestCamelCase";
   //                 0   4    9   13
@@ -115,3 +170,236 @@ TEST_CASE("to_upper_inplace") {
   to_upper_inplace(word);
   CHECK(word == L"ELEPHANT");
 }
+
+namespace {
+std::wstring tokenizer_sample_text() {
+  std::wstring text;
+  for (int i = 0; i < 1000; ++i)
+    text += L"Some sample, text with-delimiters\tи немного кириллицы: CamelCaseWords don't_stop 12345\n";
+  return text;
+}
+} // namespace
+
+TEST_CASE("Delimiter table") {
+  Settings settings;
+  auto text = tokenizer_sample_text();
+  for (auto style : {TokenizationStyle::by_non_alphabetic, TokenizationStyle::by_non_ansi, TokenizationStyle::by_delimiters}) {
+    for (auto split_camel_case : {false, true}) {
+      {
+        auto mut = settings.modify_without_saving();
+        mut->data.tokenization_style = style;
+        mut->data.split_camel_case = split_camel_case;
+      }
+      auto reference = Tokenizer(text, [&](wchar_t c) { return settings.is_delimiter(c); }, split_camel_case);
+      auto tokenizer = settings.tokenizer(text);
+      CHECK(tokenizer.get_all_tokens() == reference.get_all_tokens());
+      for (TextPosition i = 0; i < 200; ++i) {
+        CHECK(tokenizer.prev_token_begin(i) == reference.prev_token_begin(i));
+        CHECK(tokenizer.next_token_end(i) == reference.next_token_end(i));
+      }
+    }
+  }
+}
+
+TEST_CASE("Vectorized tokenization") {
+  auto is_delimiter = [](wchar_t c) { return c == L' ' || c == L',' || c == L'\n' || c == L'-' || c == L'~' || c == L'1' || c == L'\x7f' || c == L'\u2014'; };
+  DelimiterTable table(is_delimiter);
+  REQUIRE(table.ascii_ranges() != nullptr);
+
+  SECTION("CamelCase") {
+    DelimiterTable space_table([](wchar_t c) { return c == L' '; });
+    auto tokens = [&](std::wstring_view s) { return Tokenizer(s, std::cref(space_table), true).get_all_tokens(); };
+    CHECK(tokens(L"TestCamelCase") == std::vector<std::wstring_view>{L"Test", L"Camel", L"Case"});
+    CHECK(tokens(L"TestCamelCaseAndABBREVIATION") == std::vector<std::wstring_view>{L"Test", L"Camel", L"Case", L"And", L"ABBREVIATION"});
+    CHECK(tokens(L"TestCamelCaseAndABBREVIATIONAndSomeMoreCamelCase") ==
+          std::vector<std::wstring_view>{L"Test", L"Camel", L"Case", L"And", L"ABBREVIATION", L"And", L"Some", L"More", L"Camel", L"Case"});
+    CHECK(tokens(L"  splitCamelCase  ASCIIAndNonASCIIПриветМир  ") ==
+          std::vector<std::wstring_view>{L"split", L"Camel", L"Case", L"ASCII", L"And", L"Non", L"ASCII", L"Привет", L"Мир"});
+  }
+
+  SECTION("Same as scalar") {
+    // Characters are chosen so blocks are often mixed and camel case boundaries and delimiter runs hit block edges
+    const std::wstring_view alphabet = L"abZQ ,\n'1xY_-~\x7f\u2014\u0430\u0411e";
+    std::mt19937 rng(42);
+    for (int i = 0; i < 2000; ++i) {
+      std::wstring text;
+      const bool ascii_only = i % 2 == 0;
+      const auto length = rng() % 80;
+      while (text.length() < length) {
+        auto c = alphabet[rng() % alphabet.length()];
+        if (!ascii_only || c < 0x80)
+          text.push_back(c);
+      }
+      for (auto split_camel_case : {false, true}) {
+        INFO(to_string(text));
+        CHECK(Tokenizer(text, std::cref(table), split_camel_case).get_all_tokens() ==
+              Tokenizer(text, is_delimiter, split_camel_case).get_all_tokens());
+      }
+    }
+  }
+}
+
+TEST_CASE("Tokenizer benchmark", "[.][benchmark]") {
+  Settings settings;
+  auto text = tokenizer_sample_text();
+  auto length = static_cast<TextPosition>(text.length());
+  for (auto style : {TokenizationStyle::by_non_alphabetic, TokenizationStyle::by_non_ansi, TokenizationStyle::by_delimiters}) {
+    {
+      auto mut = settings.modify_without_saving();
+      mut->data.tokenization_style = style;
+    }
+    auto style_name = std::to_string(static_cast<int>(style));
+    auto reference = Tokenizer(text, [&](wchar_t c) { return settings.is_delimiter(c); }, false);
+    auto tokenizer = settings.tokenizer(text);
+    BENCHMARK("get_all_tokens, predicate, style " + style_name) { return reference.get_all_tokens(); };
+    BENCHMARK("get_all_tokens, table, style " + style_name) { return tokenizer.get_all_tokens(); };
+    BENCHMARK("prev_token_begin, table, style " + style_name) {
+      TextPosition sum = 0;
+      for (TextPosition i = 0; i < length; i += 7)
+        sum += tokenizer.prev_token_begin(i);
+      return sum;
+    };
+    BENCHMARK("next_token_end, table, style " + style_name) {
+      TextPosition sum = 0;
+      for (TextPosition i = 0; i < length; i += 7)
+        sum += tokenizer.next_token_end(i);
+      return sum;
+    };
+  }
+}
+
+TEST_CASE("Word boundary tokenization") {
+  auto tokens = [](std::wstring_view s, bool split_camel_case = false) { return WordBoundaryTokenizer(s, split_camel_case).get_all_tokens(); };
+
+  SECTION("Words") {
+    CHECK(tokens(L"Don't split e.g. 3.14 or l'avion, but do split well-known words.") ==
+          std::vector<std::wstring_view>{L"Don't", L"split", L"e.g", L"3.14", L"or", L"l'avion", L"but", L"do", L"split", L"well", L"known", L"words"});
+    CHECK(tokens(L"\u2019quoted\u2019 it\u2019s 1,000,000 snake_case_name") ==
+          std::vector<std::wstring_view>{L"quoted", L"it\u2019s", L"1,000,000", L"snake_case_name"});
+    CHECK(tokens(L"Съешь ещё этих мягких булок") == std::vector<std::wstring_view>{L"Съешь", L"ещё", L"этих", L"мягких", L"булок"});
+    // combining marks and format characters stay within words
+    CHECK(tokens(L"cafe\u0301 co\u00ADoperate") == std::vector<std::wstring_view>{L"cafe\u0301", L"co\u00ADoperate"});
+    CHECK(tokens(L"\u05D0\"\u05D1 \u30A2\u30A4\u30A6") == std::vector<std::wstring_view>{L"\u05D0\"\u05D1", L"\u30A2\u30A4\u30A6"});
+    // characters outside of BMP
+    CHECK(tokens(L"\U0001D400\U0001D401 \U0001F600 x") == std::vector<std::wstring_view>{L"\U0001D400\U0001D401", L"x"});
+    CHECK(tokens(L"  ,. \n").empty());
+    CHECK(tokens(L"").empty());
+  }
+
+  SECTION("CamelCase") {
+    CHECK(tokens(L"TestCamelCaseAndABBREVIATIONAndSomeMoreCamelCase", true) ==
+          std::vector<std::wstring_view>{L"Test", L"Camel", L"Case", L"And", L"ABBREVIATION", L"And", L"Some", L"More", L"Camel", L"Case"});
+    CHECK(tokens(L"isn'tCamel", true) == std::vector<std::wstring_view>{L"isn't", L"Camel"});
+  }
+
+  SECTION("Property table") {
+    char32_t next = 0;
+    for (auto &range : word_break_data::ranges) {
+      if (next < range.first)
+        CHECK(word_break_property(range.first - 1) == WordBreakProperty::other);
+      CHECK(word_break_property(range.first) == range.property);
+      CHECK(word_break_property(range.last) == range.property);
+      next = range.last + 1;
+    }
+    CHECK(word_break_property(0x10FFFF) == WordBreakProperty::other);
+    CHECK(word_break_property(0x110000) == WordBreakProperty::other);
+  }
+
+  SECTION("Same tokens and positions by all methods") {
+    const std::wstring_view alphabet = L"abZQ ,.\n\r'1_-\":\u05D0\u0301\u200D\u00AD\u30A2\u0430\u0411";
+    const std::array<std::wstring_view, 3> surrogate_pairs = {L"\U0001F1E6", L"\U0001F600", L"\U0001D400"};
+    std::mt19937 rng(42);
+    for (int i = 0; i < 2000; ++i) {
+      std::wstring text;
+      const auto length = rng() % 40;
+      while (text.length() < length) {
+        if (rng() % 8 == 0)
+          text += surrogate_pairs[rng() % surrogate_pairs.size()];
+        else
+          text.push_back(alphabet[rng() % alphabet.length()]);
+      }
+      for (auto split_camel_case : {false, true}) {
+        INFO(to_string(text));
+        WordBoundaryTokenizer tokenizer(text, split_camel_case);
+        const auto all_tokens = tokenizer.get_all_tokens();
+        std::vector<std::wstring_view> forward, backward;
+        for (auto token : tokenizer.tokens())
+          forward.push_back(token);
+        for (auto token : tokenizer.reversed_tokens())
+          backward.insert(backward.begin(), token);
+        CHECK(forward == all_tokens);
+        CHECK(backward == all_tokens);
+
+        std::vector<std::optional<std::array<TextPosition, 2>>> token_at(text.length());
+        for (auto token : all_tokens) {
+          const auto begin = static_cast<TextPosition>(token.data() - text.data());
+          const auto end = begin + static_cast<TextPosition>(token.length());
+          for (auto j = begin; j < end; ++j)
+            token_at[j] = std::array{begin, end};
+        }
+        for (TextPosition j = 0; j < static_cast<TextPosition>(text.length()); ++j) {
+          CHECK(tokenizer.next_token_end(j) == (token_at[j] ? (*token_at[j])[1] : j));
+          auto expected_begin = j;
+          if (token_at[j])
+            expected_begin = (*token_at[j])[0];
+          else if (j > 0 && token_at[j - 1] && (*token_at[j - 1])[1] == j)
+            expected_begin = (*token_at[j - 1])[0];
+          CHECK(tokenizer.prev_token_begin(j) == expected_begin);
+        }
+      }
+    }
+  }
+
+  SECTION("Settings") {
+    Settings settings;
+    settings.modify_without_saving()->data.tokenization_style = TokenizationStyle::by_word_boundaries;
+    settings.do_with_tokenizer(L"it's 2.5 times", [](const auto &tokenizer) {
+      CHECK(tokenizer.get_all_tokens() == std::vector<std::wstring_view>{L"it's", L"2.5", L"times"});
+      CHECK(tokenizer.next_token_end(1) == 4);
+      CHECK(tokenizer.prev_token_begin(8) == 5);
+    });
+  }
+}
+
+TEST_CASE("Word boundary tokenizer benchmark", "[.][benchmark]") {
+  Settings settings;
+  auto text = tokenizer_sample_text();
+  auto length = static_cast<TextPosition>(text.length());
+  for (auto style : {TokenizationStyle::by_non_alphabetic, TokenizationStyle::by_word_boundaries}) {
+    settings.modify_without_saving()->data.tokenization_style = style;
+    auto style_name = std::to_string(static_cast<int>(style));
+    BENCHMARK("get_all_tokens, style " + style_name) {
+      return settings.do_with_tokenizer(text, [](const auto &tokenizer) { return tokenizer.get_all_tokens(); });
+    };
+    BENCHMARK("next_token_end, style " + style_name) {
+      return settings.do_with_tokenizer(text, [&](const auto &tokenizer) {
+        TextPosition sum = 0;
+        for (TextPosition i = 0; i < length; i += 7)
+          sum += tokenizer.next_token_end(i);
+        return sum;
+      });
+    };
+  }
+}
+
+TEST_CASE("Case benchmark", "[.][benchmark]") {
+  auto text = tokenizer_sample_text();
+  Settings settings;
+  auto tokens = settings.do_with_tokenizer(text, [](const auto &tokenizer) { return tokenizer.get_all_tokens(); });
+  BENCHMARK("get_string_case_type") {
+    size_t title_count = 0;
+    for (auto token : tokens)
+      if (get_string_case_type(token) == string_case_type::title)
+        ++title_count;
+    return title_count;
+  };
+  BENCHMARK("apply_case_type") {
+    size_t length = 0;
+    for (auto token : tokens) {
+      std::wstring word(token);
+      apply_case_type(word, string_case_type::upper);
+      length += word.length();
+    }
+    return length;
+  };
+}
@@ -0,0 +1,101 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "spellers/HunspellInterface.h"
+#include "spellers/SuggestionRequest.h"
+
+#include <atomic>
+#include <catch.hpp>
+#include <future>
+
+namespace {
+SuggestionRequest::Computation suggest(std::vector<std::string> list, std::shared_future<void> released = {}) {
+  return [list = std::move(list), released](concurrency::cancellation_token) -> std::optional<RequestedSuggestions> {
+    if (released.valid())
+      released.wait();
+    return RequestedSuggestions{list, 0};
+  };
+}
+} // namespace
+
+TEST_CASE("Suggestion request") {
+  DicInfo english, russian;
+  SuggestionRequest::Dics dics{&english};
+  SuggestionRequest request;
+
+  SECTION("Finished request") {
+    request.start(L"helo", dics, suggest({"hello", "halo"}));
+    CHECK(request.is_made_for(L"helo", dics));
+    request.wait();
+    auto result = request.take(L"helo", dics);
+    REQUIRE(result);
+    CHECK(result->list == std::vector<std::string>{"hello", "halo"});
+    CHECK(result->dic_index == 0u);
+    // result is taken only once
+    CHECK_FALSE(request.is_made_for(L"helo", dics));
+    CHECK_FALSE(request.take(L"helo", dics));
+  }
+
+  SECTION("Stale word") {
+    request.start(L"helo", dics, suggest({"hello"}));
+    request.start(L"wrold", dics, suggest({"world"}));
+    CHECK_FALSE(request.is_made_for(L"helo", dics));
+    request.wait();
+    CHECK_FALSE(request.take(L"helo", dics));
+    // request for another word is dropped as well, since the menu is shown for some other word
+    CHECK_FALSE(request.take(L"wrold", dics));
+  }
+
+  SECTION("Changed language") {
+    request.start(L"helo", dics, suggest({"hello"}));
+    request.wait();
+    CHECK_FALSE(request.is_made_for(L"helo", {&russian}));
+    CHECK_FALSE(request.take(L"helo", {&english, &russian}));
+    CHECK_FALSE(request.take(L"helo", dics));
+  }
+
+  SECTION("Cancelled request") {
+    std::promise<void> started, release;
+    std::atomic<bool> was_cancelled = false;
+    request.start(L"helo", dics, [&, released = release.get_future().share()](concurrency::cancellation_token token) -> std::optional<RequestedSuggestions> {
+      started.set_value();
+      released.wait();
+      was_cancelled = token.is_canceled();
+      return RequestedSuggestions{{"hello"}, 0};
+    });
+    started.get_future().wait();
+    request.cancel();
+    CHECK_FALSE(request.is_made_for(L"helo", dics));
+    release.set_value();
+    request.wait();
+    CHECK(was_cancelled);
+    CHECK_FALSE(request.take(L"helo", dics));
+  }
+
+  SECTION("Unfinished request isn't waited for") {
+    std::promise<void> release;
+    request.start(L"helo", dics, suggest({"hello"}, release.get_future().share()));
+    // suggestions are computed synchronously by the caller instead
+    CHECK_FALSE(request.take(L"helo", dics));
+    release.set_value();
+    request.wait();
+    CHECK_FALSE(request.take(L"helo", dics));
+  }
+
+  SECTION("Unavailable dictionaries") {
+    request.start(L"helo", dics, [](concurrency::cancellation_token) { return std::optional<RequestedSuggestions>{}; });
+    request.wait();
+    CHECK_FALSE(request.take(L"helo", dics));
+  }
+}
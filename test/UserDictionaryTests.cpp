@@ -0,0 +1,74 @@
+// This file is part of DSpellCheck Plug-in for Notepad++
+// Copyright (C)2019 Sergey Semushin <Predelnik@gmail.com>
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+#include "spellers/UserDictionary.h"
+
+#include <catch.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+std::string read_file(const std::filesystem::path &path) {
+  std::ifstream is(path, std::ios::binary);
+  std::stringstream ss;
+  ss << is.rdbuf();
+  return ss.str();
+}
+} // namespace
+
+TEST_CASE("User dictionary") {
+  auto directory = std::filesystem::temp_directory_path() / (L"DSpellCheckTest_user_dictionary_" + std::to_wstring(GetCurrentProcessId()));
+  std::filesystem::create_directories(directory);
+  auto path = directory / L"UserDic.dic";
+  std::ofstream(path, std::ios::binary) << "\xEF\xBB\xBF"
+                                           "5\r\nalpha\r\nbeta\r\nalpha\r\n";
+
+  {
+    UserDictionary dictionary(path.wstring());
+    CHECK(dictionary.words() == std::vector<std::string>{"alpha", "beta"});
+    CHECK(dictionary.add("gamma"));
+    CHECK(dictionary.add("beta"));
+    CHECK(dictionary.words() == std::vector<std::string>{"alpha", "beta", "gamma"});
+    // file itself is untouched until merge, but the word is already in the journal
+    CHECK(read_file(dictionary.journal_path()) == "gamma\r\n");
+
+    // merge keeps words added to the file by other means
+    std::ofstream(path, std::ios::binary | std::ios::app) << "delta\r\n";
+    CHECK(UserDictionary(path.wstring()).words() == std::vector<std::string>{"alpha", "beta", "delta", "gamma"});
+  }
+  CHECK(read_file(path) == "4\r\nalpha\r\nbeta\r\ndelta\r\ngamma\r\n");
+  CHECK_FALSE(std::filesystem::exists(path.wstring() + L".journal"));
+
+  {
+    UserDictionary dictionary(path.wstring());
+    for (int i = 0; i < 300; ++i)
+      dictionary.add("word" + std::to_string(i));
+  }
+  UserDictionary dictionary(path.wstring());
+  CHECK(dictionary.words().size() == 304);
+  CHECK(read_file(path).starts_with("304\r\n"));
+
+  // count which went out of date after editing by hand is still the count, it's fixed on merge
+  std::ofstream(path, std::ios::binary) << "7\r\nalpha\r\n";
+  {
+    UserDictionary stale_dictionary(path.wstring());
+    CHECK(stale_dictionary.words() == std::vector<std::string>{"alpha"});
+    CHECK(stale_dictionary.add("beta"));
+  }
+  CHECK(read_file(path) == "2\r\nalpha\r\nbeta\r\n");
+
+  std::error_code ec;
+  std::filesystem::remove_all(directory, ec);
+}